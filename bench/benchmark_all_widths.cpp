@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "benchmark_options.h"
+
+// Every perf_benchmark_int* case at 128, 256, 512 and 1024 bits in one
+// binary. benchmark_int256.cpp is built once per width with
+// GINT_BENCH_ALL_WIDTHS and linked in here; each width registers its cases
+// with a "/bits:<N>" suffix, which summarize_benchmarks.py groups into a
+// width-scaling table. Takes the same --gint_* switches.
+int main(int argc, char ** argv)
+{
+    gint_bench::options & flags = gint_bench::parse_options(argc, argv);
+    flags.name_suffix = "/bits:128";
+    gint_bench::register_width_cases<128>(flags);
+    flags.name_suffix = "/bits:256";
+    gint_bench::register_width_cases<256>(flags);
+    flags.name_suffix = "/bits:512";
+    gint_bench::register_width_cases<512>(flags);
+    flags.name_suffix = "/bits:1024";
+    gint_bench::register_width_cases<1024>(flags);
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
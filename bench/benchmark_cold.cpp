@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <gint/gint.h>
+
+// Streaming kernels over UInt256 rows whose working set grows from L1 to
+// DRAM size. The benchmark argument is the total footprint in bytes of the
+// arrays one pass touches: 16 KiB, 64 KiB, 1 MiB, 16 MiB and 256 MiB, roughly
+// L1, L2, LLC and DRAM on current server parts. Each pass visits every row
+// once in order, so the larger arguments price the kernel against memory
+// bandwidth and the hardware prefetcher instead of against operands that stay
+// in cache. Every row reports items and bytes per second and ns_per_element.
+namespace
+{
+using Row = gint::UInt256;
+
+// UInt256 max has 78 decimal digits.
+constexpr size_t kDigitSlot = 80;
+
+std::vector<Row> random_rows(size_t count, uint64_t seed)
+{
+    std::vector<Row> rows(count);
+    std::mt19937_64 rng(seed);
+    for (Row & value : rows)
+        value = (Row(rng()) << 192) | (Row(rng()) << 128) | (Row(rng()) << 64) | Row(rng());
+    return rows;
+}
+
+size_t row_count(const benchmark::State & state, size_t bytes_per_row)
+{
+    return std::max<size_t>(1, static_cast<size_t>(state.range(0)) / bytes_per_row);
+}
+
+void report(benchmark::State & state, size_t rows, size_t bytes_per_row)
+{
+    const int64_t processed = static_cast<int64_t>(state.iterations() * rows);
+    state.SetItemsProcessed(processed);
+    state.SetBytesProcessed(processed * static_cast<int64_t>(bytes_per_row));
+    // An inverted rate of processed * 1e-9 is nanoseconds per row; the console
+    // appends "s" to inverted rates, the JSON value is the plain number.
+    state.counters["ns_per_element"]
+        = benchmark::Counter(static_cast<double>(processed) * 1e-9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// out[i] = a[i] + b[i]
+void Add(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = 3 * sizeof(Row);
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 1);
+    const auto b = random_rows(rows, 2);
+    std::vector<Row> out(rows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            out[i] = a[i] + b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+// out[i] = a[i] * b[i]
+void Mul(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = 3 * sizeof(Row);
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 3);
+    const auto b = random_rows(rows, 4);
+    std::vector<Row> out(rows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+// mask[i] = a[i] < b[i]
+void Less(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = 2 * sizeof(Row) + 1;
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 5);
+    const auto b = random_rows(rows, 6);
+    std::vector<unsigned char> mask(rows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            mask[i] = static_cast<unsigned char>(a[i] < b[i]);
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+// hashes[i] = std::hash(a[i]), as when building a hash table over a column.
+void Hash(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = sizeof(Row) + sizeof(size_t);
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 7);
+    std::vector<size_t> hashes(rows);
+    const std::hash<Row> hasher;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            hashes[i] = hasher(a[i]);
+        benchmark::DoNotOptimize(hashes.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+// out[i] = a[i] / d for a 64-bit divisor known only at run time.
+void DivideByScalar(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = 2 * sizeof(Row);
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 8);
+    uint64_t divisor = 1000000007;
+    benchmark::DoNotOptimize(divisor);
+    std::vector<Row> out(rows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            out[i] = a[i] / divisor;
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+// Decimal text of a[i] written into a fixed kDigitSlot-byte slot per row.
+void ToChars(benchmark::State & state)
+{
+    constexpr size_t bytes_per_row = sizeof(Row) + kDigitSlot;
+    const size_t rows = row_count(state, bytes_per_row);
+    const auto a = random_rows(rows, 9);
+    std::vector<char> text(rows * kDigitSlot);
+    for (auto _ : state)
+    {
+        char * slot = text.data();
+        for (size_t i = 0; i < rows; ++i, slot += kDigitSlot)
+            gint::to_chars(slot, slot + kDigitSlot, a[i]);
+        benchmark::DoNotOptimize(text.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, rows, bytes_per_row);
+}
+
+void working_sets(benchmark::internal::Benchmark * b)
+{
+    b->ArgName("bytes")->RangeMultiplier(16)->Range(16 << 10, 256 << 20);
+}
+} // namespace
+
+BENCHMARK(Add)->Name("Cold/Add")->Apply(working_sets);
+BENCHMARK(Mul)->Name("Cold/Mul")->Apply(working_sets);
+BENCHMARK(Less)->Name("Cold/Less")->Apply(working_sets);
+BENCHMARK(Hash)->Name("Cold/Hash")->Apply(working_sets);
+BENCHMARK(DivideByScalar)->Name("Cold/DivideByScalar")->Apply(working_sets);
+BENCHMARK(ToChars)->Name("Cold/ToChars")->Apply(working_sets);
+
+BENCHMARK_MAIN();
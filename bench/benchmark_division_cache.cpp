@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <gint/gint.h>
+
+// Division loops whose divisor is invariant but only known at run time. The
+// file builds twice: perf_benchmark_division with the default configuration
+// and perf_benchmark_division_cached with GINT_ENABLE_DIVISION_CACHE, so the
+// same rows of the two binaries compare directly. The cached build also
+// reports the cache hit rate of each row.
+//
+// Both builds run the same 3-by-2 reciprocal loop; a hit only skips the
+// divisor's normalization and reciprocal. Within the cached build,
+// DivideByInvariant (all hits) against RotateDivisors of the same argument
+// (all misses) prices the lookup on a miss.
+namespace
+{
+constexpr size_t kRows = 4096;
+
+template <typename Int>
+std::vector<Int> random_values(size_t limbs, uint64_t seed)
+{
+    std::vector<Int> values(kRows);
+    std::mt19937_64 rng(seed);
+    for (Int & value : values)
+    {
+        value = 0;
+        for (size_t i = 0; i < limbs; ++i)
+            value = (value << 64) | Int(rng());
+    }
+    return values;
+}
+
+template <typename Int>
+Int divisor_of_limbs(size_t limbs, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    Int divisor = Int(rng() | 1);
+    for (size_t i = 1; i < limbs; ++i)
+        divisor = (divisor << 64) | Int(rng());
+    return divisor;
+}
+
+void report(benchmark::State & state)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+#if defined(GINT_ENABLE_DIVISION_CACHE)
+    const gint::division_cache_stats stats = gint::division_cache_statistics();
+    const double lookups = static_cast<double>(stats.hits + stats.misses);
+    state.counters["hit_rate"] = lookups == 0 ? 0.0 : static_cast<double>(stats.hits) / lookups;
+#endif
+}
+
+// out[i] = values[i] / d, as when rescaling fixed-point amounts by a run-time scale.
+template <typename Int>
+void DivideByInvariant(benchmark::State & state)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    const auto values = random_values<Int>(limbs, 1);
+    const Int divisor = divisor_of_limbs<Int>(static_cast<size_t>(state.range(0)), 2);
+    std::vector<Int> out(kRows);
+    gint::reset_division_cache_statistics();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = values[i] / divisor;
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+// out[i] = values[i] % m for a run-time modulus one limb narrower than the values.
+template <typename Int>
+void ModByInvariant(benchmark::State & state)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    const auto values = random_values<Int>(limbs, 3);
+    const Int modulus = divisor_of_limbs<Int>(limbs - 1, 4);
+    std::vector<Int> out(kRows);
+    gint::reset_division_cache_statistics();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = values[i] % modulus;
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+// Like DivideByInvariant, but each row takes the next of kRotatingDivisors
+// divisors of the same width. One more divisor than the cache has ways makes
+// every lookup miss under round-robin replacement.
+constexpr size_t kRotatingDivisors = 5;
+
+template <typename Int>
+void RotateDivisors(benchmark::State & state)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    const auto values = random_values<Int>(limbs, 1);
+    Int divisors[kRotatingDivisors];
+    for (size_t k = 0; k < kRotatingDivisors; ++k)
+        divisors[k] = divisor_of_limbs<Int>(static_cast<size_t>(state.range(0)), 2 + 10 * k);
+    std::vector<Int> out(kRows);
+    gint::reset_division_cache_statistics();
+    size_t k = 0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+        {
+            out[i] = values[i] / divisors[k];
+            k = k + 1 == kRotatingDivisors ? 0 : k + 1;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+// Two divisors in alternation, e.g. a quotient and a rounding step per row.
+template <typename Int>
+void AlternateTwoDivisors(benchmark::State & state)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    const auto values = random_values<Int>(limbs, 5);
+    const Int divisors[2] = {divisor_of_limbs<Int>(2, 6), divisor_of_limbs<Int>(limbs / 2 + 1, 7)};
+    std::vector<Int> out(kRows);
+    gint::reset_division_cache_statistics();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = values[i] / divisors[i & 1];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+// A new divisor per row: every lookup misses, so this row prices the cache overhead.
+template <typename Int>
+void DistinctDivisors(benchmark::State & state)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    const auto values = random_values<Int>(limbs, 8);
+    auto divisors = random_values<Int>(limbs, 9);
+    for (Int & divisor : divisors)
+        divisor >>= 64 * (limbs / 2);
+    std::vector<Int> out(kRows);
+    gint::reset_division_cache_statistics();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = values[i] / divisors[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(DivideByInvariant, gint::UInt256)->Name("DivisionCache/DivideByInvariant/256")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_TEMPLATE(DivideByInvariant, gint::integer<512, unsigned>)->Name("DivisionCache/DivideByInvariant/512")->Arg(2)->Arg(4);
+BENCHMARK_TEMPLATE(DivideByInvariant, gint::integer<1024, unsigned>)->Name("DivisionCache/DivideByInvariant/1024")->Arg(2)->Arg(8);
+BENCHMARK_TEMPLATE(RotateDivisors, gint::UInt256)->Name("DivisionCache/RotateDivisors/256")->Arg(2)->Arg(3);
+BENCHMARK_TEMPLATE(RotateDivisors, gint::integer<512, unsigned>)->Name("DivisionCache/RotateDivisors/512")->Arg(2)->Arg(4);
+BENCHMARK_TEMPLATE(RotateDivisors, gint::integer<1024, unsigned>)->Name("DivisionCache/RotateDivisors/1024")->Arg(2)->Arg(8);
+BENCHMARK_TEMPLATE(ModByInvariant, gint::UInt256)->Name("DivisionCache/ModByInvariant/256");
+BENCHMARK_TEMPLATE(ModByInvariant, gint::integer<512, unsigned>)->Name("DivisionCache/ModByInvariant/512");
+BENCHMARK_TEMPLATE(AlternateTwoDivisors, gint::Int256)->Name("DivisionCache/AlternateTwoDivisors/256");
+BENCHMARK_TEMPLATE(DistinctDivisors, gint::UInt256)->Name("DivisionCache/DistinctDivisors/256");
+BENCHMARK_TEMPLATE(DistinctDivisors, gint::integer<1024, unsigned>)->Name("DivisionCache/DistinctDivisors/1024");
+
+BENCHMARK_MAIN();
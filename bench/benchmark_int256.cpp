@@ -6,15 +6,20 @@
 #    include <boost/multiprecision/cpp_int.hpp>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <random>
 #include <string>
 #include <vector>
 
 #include <gint/gint.h>
 
+#include "benchmark_options.h"
+
 #ifndef GINT_BENCH_BITS
 #    define GINT_BENCH_BITS 256
 #endif
@@ -23,6 +28,14 @@ constexpr size_t kBenchBits = GINT_BENCH_BITS;
 static_assert(kBenchBits % 64 == 0, "benchmark widths must be limb-aligned");
 static_assert(kBenchBits >= 128, "benchmark widths must be at least 128 bits");
 
+// perf_benchmark_all_widths links one build of this file per width; with
+// GINT_BENCH_ALL_WIDTHS everything below up to the entry point has internal
+// linkage, so the per-width definitions of the same names do not collide.
+#if defined(GINT_BENCH_ALL_WIDTHS)
+namespace
+{
+#endif
+
 // Keep the shared comparison matrix in one mathematical value domain. gint and
 // ClickHouse use two's-complement signed integers, while Boost's fixed signed
 // backend uses signed-magnitude. Feeding the same raw words to those signed
@@ -122,9 +135,9 @@ bool verify_comparison_value_domain()
 
 // -------- Addition --------
 template <typename Int>
-static void Add_NoCarry(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & add_no_carry_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xA55A'AA55'1234'5678ull);
@@ -137,6 +150,13 @@ static void Add_NoCarry(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Add_NoCarry(benchmark::State & state)
+{
+    const auto & data = add_no_carry_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -171,9 +191,9 @@ static void Add_WidePlusU64(benchmark::State & state)
 // -------- Mixed-operand: wide * u64 (compare) --------
 // Use fully random wide 'a' to avoid accidentally benchmarking a degenerate one-limb case.
 template <typename Int>
-static void Mul_WideTimesU64(benchmark::State & state)
+static const std::array<std::pair<Int, uint64_t>, kDataN> & mul_wide_times_u64_data()
 {
-    static std::array<std::pair<Int, uint64_t>, kDataN> data = []
+    static const std::array<std::pair<Int, uint64_t>, kDataN> data = []
     {
         std::array<std::pair<Int, uint64_t>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x13579BDF'2468'ACE0ull);
@@ -185,6 +205,13 @@ static void Mul_WideTimesU64(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Mul_WideTimesU64(benchmark::State & state)
+{
+    const auto & data = mul_wide_times_u64_data<Int>();
     size_t i = 0;
     for (auto _ : state)
     {
@@ -196,16 +223,23 @@ static void Mul_WideTimesU64(benchmark::State & state)
 }
 
 template <typename Int>
-static void Add_FullCarry(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & add_full_carry_data()
 {
     // Worst-case: all bits set + 1 causes ripple across all limbs
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         for (size_t i = 0; i < kDataN; ++i)
             d[i] = {~Int{0}, Int{1}};
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Add_FullCarry(benchmark::State & state)
+{
+    const auto & data = add_full_carry_data<Int>();
     size_t i = 0;
     for (auto _ : state)
     {
@@ -217,9 +251,9 @@ static void Add_FullCarry(benchmark::State & state)
 
 // -------- Subtraction --------
 template <typename Int>
-static void Sub_NoBorrow(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & sub_no_borrow_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xBEEF'FACE'CAFEBABEull);
@@ -233,6 +267,13 @@ static void Sub_NoBorrow(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Sub_NoBorrow(benchmark::State & state)
+{
+    const auto & data = sub_no_borrow_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -265,16 +306,23 @@ static void Sub_WideMinusU64(benchmark::State & state)
 }
 
 template <typename Int>
-static void Sub_FullBorrow(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & sub_full_borrow_data()
 {
     // Worst-case: 0 - 1 borrows across all limbs
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         for (size_t i = 0; i < kDataN; ++i)
             d[i] = {Int{0}, Int{1}};
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Sub_FullBorrow(benchmark::State & state)
+{
+    const auto & data = sub_full_borrow_data<Int>();
     size_t i = 0;
     for (auto _ : state)
     {
@@ -286,9 +334,9 @@ static void Sub_FullBorrow(benchmark::State & state)
 
 // -------- Multiplication --------
 template <typename Int>
-static void Mul_U64xU64(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & mul_u64xu64_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xC001'D00D'BADC'0FFEuLL);
@@ -296,6 +344,13 @@ static void Mul_U64xU64(benchmark::State & state)
             d[i] = {Int{rng()}, Int{rng()}};
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Mul_U64xU64(benchmark::State & state)
+{
+    const auto & data = mul_u64xu64_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -308,9 +363,9 @@ static void Mul_U64xU64(benchmark::State & state)
 }
 
 template <typename Int>
-static void Mul_HighxHigh(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & mul_high_x_high_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xDEAD'BEEF'8BAD'F00Dull);
@@ -323,6 +378,13 @@ static void Mul_HighxHigh(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Mul_HighxHigh(benchmark::State & state)
+{
+    const auto & data = mul_high_x_high_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -336,9 +398,9 @@ static void Mul_HighxHigh(benchmark::State & state)
 
 // -------- Division --------
 template <typename Int>
-static void Div_SmallDivisor32(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & div_small_divisor32_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x1234'5678'9ABC'DEF0ull);
@@ -351,6 +413,13 @@ static void Div_SmallDivisor32(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Div_SmallDivisor32(benchmark::State & state)
+{
+    const auto & data = div_small_divisor32_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -364,9 +433,9 @@ static void Div_SmallDivisor32(benchmark::State & state)
 
 // Division with a 64-bit small divisor (not fitting in 32-bit)
 template <typename Int>
-static void Div_SmallDivisor64(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & div_small_divisor64_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xA1B2'C3D4'E5F6'1234ull);
@@ -381,6 +450,13 @@ static void Div_SmallDivisor64(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Div_SmallDivisor64(benchmark::State & state)
+{
+    const auto & data = div_small_divisor64_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -393,9 +469,9 @@ static void Div_SmallDivisor64(benchmark::State & state)
 }
 
 template <typename Int>
-static void Div_Pow2Divisor(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & div_pow2_divisor_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0xF00F'F00F'00F0'0F00ull);
@@ -409,6 +485,13 @@ static void Div_Pow2Divisor(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Div_Pow2Divisor(benchmark::State & state)
+{
+    const auto & data = div_pow2_divisor_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -421,9 +504,9 @@ static void Div_Pow2Divisor(benchmark::State & state)
 }
 
 template <typename Int>
-static void Div_SimilarMagnitude(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & div_similar_magnitude_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x0BAD'CAFE'FEED'FACEull);
@@ -437,6 +520,13 @@ static void Div_SimilarMagnitude(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Div_SimilarMagnitude(benchmark::State & state)
+{
+    const auto & data = div_similar_magnitude_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -449,7 +539,7 @@ static void Div_SimilarMagnitude(benchmark::State & state)
 }
 
 template <typename Int>
-static void ToString(benchmark::State & state)
+static const std::array<Int, kDataN> & to_string_data()
 {
     // Use a static dataset with varied magnitudes to prevent constant folding
     // and ensure reproducibility across iterations
@@ -465,7 +555,13 @@ static void ToString(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
 
+template <typename Int>
+static void ToString(benchmark::State & state)
+{
+    const auto & data = to_string_data<Int>();
     size_t i = 0;
     for (auto _ : state)
     {
@@ -475,6 +571,24 @@ static void ToString(benchmark::State & state)
     }
 }
 
+#if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
+// Same dataset as ToString, written into a caller-owned buffer.
+template <typename Int>
+static void ToChars(benchmark::State & state)
+{
+    const auto & data = to_string_data<Int>();
+    char buffer[kBenchBits / 3 + 2];
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const Int & a = data[i++ & (kDataN - 1)];
+        auto result = gint::to_chars(buffer, buffer + sizeof(buffer), a);
+        benchmark::DoNotOptimize(result.ptr);
+        benchmark::ClobberMemory();
+    }
+}
+#endif
+
 #if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
 template <unsigned Base>
 static std::array<std::string, kDataN> make_from_string_data()
@@ -656,9 +770,9 @@ static void Bitwise_Not(benchmark::State & state)
 
 // -------- Equality --------
 template <typename Int>
-static void Equal_Equal(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & equal_equal_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x455155414C455155ull);
@@ -669,6 +783,13 @@ static void Equal_Equal(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Equal_Equal(benchmark::State & state)
+{
+    const auto & data = equal_equal_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -679,9 +800,9 @@ static void Equal_Equal(benchmark::State & state)
 }
 
 template <typename Int, size_t DifferentBit>
-static void Equal_DifferentBit(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & equal_different_bit_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x444946464552454Eull ^ DifferentBit);
@@ -692,6 +813,13 @@ static void Equal_DifferentBit(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int, size_t DifferentBit>
+static void Equal_DifferentBit(benchmark::State & state)
+{
+    const auto & data = equal_different_bit_data<Int, DifferentBit>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -713,11 +841,26 @@ static void Equal_LowDifferent(benchmark::State & state)
     Equal_DifferentBit<Int, 0>(state);
 }
 
+// Ordering compare on the Equal/LowDifferent operands, the throughput twin of
+// Latency/Less/LowDifferent.
+template <typename Int>
+static void Less_LowDifferent(benchmark::State & state)
+{
+    const auto & data = equal_different_bit_data<Int, 0>();
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        benchmark::DoNotOptimize(p.first < p.second);
+    }
+}
+
 // -------- Shift --------
 template <typename Int>
-static void Shift_LeftVariable(benchmark::State & state)
+static const std::array<std::pair<Int, unsigned>, kDataN> & shift_left_variable_data()
 {
-    static std::array<std::pair<Int, unsigned>, kDataN> data = []
+    static const std::array<std::pair<Int, unsigned>, kDataN> data = []
     {
         std::array<std::pair<Int, unsigned>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x12345678ABCDEF01ull);
@@ -730,6 +873,13 @@ static void Shift_LeftVariable(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Shift_LeftVariable(benchmark::State & state)
+{
+    const auto & data = shift_left_variable_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -740,9 +890,9 @@ static void Shift_LeftVariable(benchmark::State & state)
 }
 
 template <typename Int>
-static void Shift_RightVariable(benchmark::State & state)
+static const std::array<std::pair<Int, unsigned>, kDataN> & shift_right_variable_data()
 {
-    static std::array<std::pair<Int, unsigned>, kDataN> data = []
+    static const std::array<std::pair<Int, unsigned>, kDataN> data = []
     {
         std::array<std::pair<Int, unsigned>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x0FEDCBA987654321ull);
@@ -755,6 +905,13 @@ static void Shift_RightVariable(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Shift_RightVariable(benchmark::State & state)
+{
+    const auto & data = shift_right_variable_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -766,9 +923,9 @@ static void Shift_RightVariable(benchmark::State & state)
 
 // -------- Modulo --------
 template <typename Int>
-static void Mod_SmallDivisor64(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & mod_small_divisor64_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x55AA3311CCDD8899ull);
@@ -782,6 +939,13 @@ static void Mod_SmallDivisor64(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Mod_SmallDivisor64(benchmark::State & state)
+{
+    const auto & data = mod_small_divisor64_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -792,9 +956,9 @@ static void Mod_SmallDivisor64(benchmark::State & state)
 }
 
 template <typename Int>
-static void Mod_SimilarMagnitude(benchmark::State & state)
+static const std::array<std::pair<Int, Int>, kDataN> & mod_similar_magnitude_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<Int, Int>, kDataN> data = []
     {
         std::array<std::pair<Int, Int>, kDataN> d{};
         std::mt19937_64 rng(kSeedBase ^ 0x0F1E2D3C4B5A6978ull);
@@ -810,6 +974,13 @@ static void Mod_SimilarMagnitude(benchmark::State & state)
         }
         return d;
     }();
+    return data;
+}
+
+template <typename Int>
+static void Mod_SimilarMagnitude(benchmark::State & state)
+{
+    const auto & data = mod_similar_magnitude_data<Int>();
 
     size_t i = 0;
     for (auto _ : state)
@@ -875,117 +1046,978 @@ static void DivMod_SimilarMagnitudeSeparate(benchmark::State & state)
         benchmark::DoNotOptimize(remainder);
     }
 }
-#endif
 
-static bool parse_full_matrix_flag(int & argc, char **& argv)
+// Signed gint divided by an unsigned builtin. Divisors have the top bit set so
+// the 128-bit cases fall outside the signed range of Int128.
+template <typename Signed, typename Divisor>
+static const std::array<std::pair<Signed, Divisor>, kDataN> & mixed_sign_division_data()
 {
-    bool full = false;
-    if (const char * env = std::getenv("GINT_BENCH_FULL"))
-        full = (std::string(env) == "1" || std::string(env) == "true");
-    // strip custom flag(s) from argv so Google Benchmark doesn't see them
-    static std::vector<char *> new_argv;
-    new_argv.clear();
-    new_argv.reserve(static_cast<size_t>(argc));
-    for (int i = 0; i < argc; ++i)
+    static const std::array<std::pair<Signed, Divisor>, kDataN> data = []
     {
-        std::string s = argv[i] ? argv[i] : "";
-        if (s == "--gint_full" || s == "--gint-full")
+        std::array<std::pair<Signed, Divisor>, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0x51D1'7E55'0000'0000ull ^ (sizeof(Divisor) * 8 + Signed::bits));
+        for (size_t i = 0; i < kDataN; ++i)
         {
-            full = true;
-            continue;
+            Signed dividend = Signed(rng());
+            for (size_t limb = 1; limb < Signed::limbs; ++limb)
+                dividend = (dividend << 64) | Signed(rng());
+            Divisor divisor = static_cast<Divisor>(rng());
+            for (size_t limb = 1; limb < sizeof(Divisor) / 8; ++limb)
+                divisor = static_cast<Divisor>((divisor << 32) << 32) | static_cast<Divisor>(rng());
+            divisor |= static_cast<Divisor>(static_cast<Divisor>(1) << (sizeof(Divisor) * 8 - 1));
+            d[i] = {dividend, divisor};
         }
-        new_argv.push_back(argv[i]);
-    }
-    argv = new_argv.data();
-    argc = static_cast<int>(new_argv.size());
-    return full;
+        return d;
+    }();
+    return data;
 }
 
-#ifdef GINT_ENABLE_CH_COMPARE
-#    define REG_CASE_CH(Base, Func) benchmark::RegisterBenchmark(Base "/ClickHouse", &Func<CInt>)
-#else
-#    define REG_CASE_CH(Base, Func)
-#endif
-#ifdef GINT_ENABLE_BOOST_COMPARE
-#    define REG_CASE_BOOST(Base, Func) benchmark::RegisterBenchmark(Base "/Boost", &Func<BInt>)
-#else
-#    define REG_CASE_BOOST(Base, Func)
-#endif
-#define REG_CASE(Base, Func) \
-    do \
-    { \
-        benchmark::RegisterBenchmark(Base "/gint", &Func<WInt>); \
-        REG_CASE_CH(Base, Func); \
-        REG_CASE_BOOST(Base, Func); \
-    } while (false)
-
-// Extra cases for the full matrix only
-template <typename Int>
-static void Add_CarryChain64(benchmark::State & state)
+template <typename Signed, typename Divisor>
+static void DivMixedSign_SignedByUnsigned(benchmark::State & state)
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    const auto & data = mixed_sign_division_data<Signed, Divisor>();
+    size_t i = 0;
+    for (auto _ : state)
     {
-        std::array<std::pair<Int, Int>, kDataN> d{};
-        std::mt19937_64 rng(kSeedBase ^ 0xCC55'DDAA'9988'7766ull);
-        for (size_t i = 0; i < kDataN; ++i)
-        {
-            Int a = random_wide_with_low_limb<Int>(rng, ~0ULL); // low limb all 1s
-            Int b = Int{1};
-            d[i] = {a, b};
-        }
-        return d;
-    }();
+        const auto & p = data[i++ & (kDataN - 1)];
+        Signed result = p.first / p.second;
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Signed, typename Divisor>
+static void DivMixedSign_UnsignedBySigned(benchmark::State & state)
+{
+    const auto & data = mixed_sign_division_data<Signed, Divisor>();
     size_t i = 0;
     for (auto _ : state)
     {
         const auto & p = data[i++ & (kDataN - 1)];
-        const Int & a = p.first;
-        const Int & b = p.second;
-        benchmark::DoNotOptimize(a + b);
+        Signed result = p.second / (p.first | Signed(1));
+        benchmark::DoNotOptimize(result);
     }
 }
 
-template <typename Int>
-static void Sub_BorrowChain64(benchmark::State & state)
+// Unsigned Q128.128 operands whose real values span [2^-64, 2^64), so
+// products and quotients stay in range.
+using FixedQ128 = gint::fixed<256, 128, unsigned>;
+
+static const std::array<std::pair<gint::UInt256, gint::UInt256>, kDataN> & fixed_point_data()
 {
-    static std::array<std::pair<Int, Int>, kDataN> data = []
+    static const std::array<std::pair<gint::UInt256, gint::UInt256>, kDataN> data = []
     {
-        std::array<std::pair<Int, Int>, kDataN> d{};
-        std::mt19937_64 rng(kSeedBase ^ 0x1122'3344'5566'7788ull);
+        std::array<std::pair<gint::UInt256, gint::UInt256>, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0xF1C5'ED00'0128'0128ull);
         for (size_t i = 0; i < kDataN; ++i)
         {
-            Int a = random_wide_with_low_limb<Int>(rng, 0); // low limb zero
-            Int b = Int{1};
-            d[i] = {a, b};
+            gint::UInt256 values[2];
+            for (auto & value : values)
+            {
+                value = (gint::UInt256(rng()) << 128) | (gint::UInt256(rng()) << 64) | gint::UInt256(rng());
+                value = (value >> static_cast<int>(rng() % 128)) | (gint::UInt256(1) << 64);
+            }
+            d[i] = {values[0], values[1]};
         }
         return d;
     }();
+    return data;
+}
+
+static void FixedMul_Q128(benchmark::State & state)
+{
+    const auto & data = fixed_point_data();
     size_t i = 0;
     for (auto _ : state)
     {
         const auto & p = data[i++ & (kDataN - 1)];
-        const Int & a = p.first;
-        const Int & b = p.second;
-        benchmark::DoNotOptimize(a - b);
+        FixedQ128 result = FixedQ128::from_raw(p.first) * FixedQ128::from_raw(p.second);
+        benchmark::DoNotOptimize(result);
     }
 }
 
-template <typename Int>
-static void Mul_WideTimesU32(benchmark::State & state)
+// The hand-written pattern fixed replaces: widen both operands, multiply, shift.
+static void FixedMul_Q128Manual(benchmark::State & state)
 {
-    static std::array<std::pair<Int, uint32_t>, kDataN> data = []
-    {
-        std::array<std::pair<Int, uint32_t>, kDataN> d{};
-        std::mt19937_64 rng(kSeedBase ^ 0x55AA'AA55'55AA'AA55ull);
-        for (size_t i = 0; i < kDataN; ++i)
-            d[i] = {random_wide<Int>(rng), static_cast<uint32_t>(rng())};
-        return d;
-    }();
+    const auto & data = fixed_point_data();
     size_t i = 0;
     for (auto _ : state)
     {
         const auto & p = data[i++ & (kDataN - 1)];
-        benchmark::DoNotOptimize(p.first * p.second);
+        gint::UInt256 result = gint::UInt256((gint::integer<512, unsigned>(p.first) * gint::integer<512, unsigned>(p.second)) >> 128);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void FixedDiv_Q128(benchmark::State & state)
+{
+    const auto & data = fixed_point_data();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        FixedQ128 result = FixedQ128::from_raw(p.first) / FixedQ128::from_raw(p.second);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void FixedDiv_Q128Manual(benchmark::State & state)
+{
+    const auto & data = fixed_point_data();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        gint::UInt256 result = gint::UInt256((gint::integer<512, unsigned>(p.first) << 128) / gint::integer<512, unsigned>(p.second));
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// 160-bit addresses: packed into 20-byte slots versus padded into UInt256.
+// A million elements (20 vs 32 MiB) spill out of L2 on common hosts.
+constexpr size_t kPackedScanN = size_t(1) << 20;
+using PackedAddresses = gint::packed_array<160, gint::UInt256>;
+
+static const std::vector<gint::UInt256> & address_data()
+{
+    static const std::vector<gint::UInt256> data = []
+    {
+        std::vector<gint::UInt256> d(kPackedScanN);
+        std::mt19937_64 rng(kSeedBase ^ 0xADD2'E550'0160'0160ull);
+        for (auto & value : d)
+            value = (gint::UInt256(rng() >> 32) << 128) | (gint::UInt256(rng()) << 64) | gint::UInt256(rng());
+        return d;
+    }();
+    return data;
+}
+
+static void report_scan(benchmark::State & state, size_t bytes)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kPackedScanN));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["bytes_per_element"] = static_cast<double>(bytes) / static_cast<double>(kPackedScanN);
+}
+
+// Search for an absent key, so every element is compared.
+static void PackedArray_Find160(benchmark::State & state)
+{
+    const auto & data = address_data();
+    PackedAddresses packed;
+    packed.reserve(data.size());
+    for (const auto & value : data)
+        packed.push_back(value);
+    const gint::UInt256 needle = gint::UInt256(1) << 159;
+    for (auto _ : state)
+    {
+        size_t index = packed.find(needle);
+        benchmark::DoNotOptimize(index);
+    }
+    report_scan(state, packed.size_bytes());
+}
+
+static void PackedArray_Find160Vector(benchmark::State & state)
+{
+    const auto & data = address_data();
+    const gint::UInt256 needle = gint::UInt256(1) << 159;
+    for (auto _ : state)
+    {
+        auto it = std::find(data.begin(), data.end(), needle);
+        benchmark::DoNotOptimize(it);
+    }
+    report_scan(state, data.size() * sizeof(gint::UInt256));
+}
+
+// Unpack into an aligned scratch block and reduce it, the bulk arithmetic path.
+static void PackedArray_Unpack160(benchmark::State & state)
+{
+    const auto & data = address_data();
+    PackedAddresses packed;
+    packed.reserve(data.size());
+    for (const auto & value : data)
+        packed.push_back(value);
+    std::array<gint::UInt256, 256> scratch;
+    for (auto _ : state)
+    {
+        gint::UInt256 sum = 0;
+        for (size_t first = 0; first < packed.size(); first += scratch.size())
+        {
+            packed.unpack(first, scratch.size(), scratch.data());
+            for (const auto & value : scratch)
+                sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    report_scan(state, packed.size_bytes());
+}
+
+// Row-wise add and compare over 256-bit columns: limb-planar gint::column
+// against a std::vector<UInt256> loop. The row count is the benchmark
+// argument; 16M rows are 512 MiB per operand.
+using ColumnRows = gint::column<256, unsigned>;
+
+static std::vector<gint::UInt256> column_rows(size_t count, uint64_t salt)
+{
+    std::vector<gint::UInt256> rows(count);
+    std::mt19937_64 rng(kSeedBase ^ salt);
+    for (auto & value : rows)
+        value = (gint::UInt256(rng()) << 192) | (gint::UInt256(rng()) << 128) | (gint::UInt256(rng()) << 64) | gint::UInt256(rng());
+    return rows;
+}
+
+static void report_rows(benchmark::State & state, size_t rows, size_t operands)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * rows * operands * sizeof(gint::UInt256)));
+}
+
+static void Column_Add256(benchmark::State & state)
+{
+    const size_t rows = static_cast<size_t>(state.range(0));
+    ColumnRows lhs;
+    ColumnRows rhs;
+    {
+        const auto a = column_rows(rows, 0xC01A);
+        const auto b = column_rows(rows, 0xC01B);
+        lhs = ColumnRows(a.data(), rows);
+        rhs = ColumnRows(b.data(), rows);
+    }
+    for (auto _ : state)
+    {
+        lhs += rhs;
+        benchmark::DoNotOptimize(lhs.plane(0));
+        benchmark::ClobberMemory();
+    }
+    report_rows(state, rows, 3);
+}
+
+static void Column_Add256Rows(benchmark::State & state)
+{
+    const size_t rows = static_cast<size_t>(state.range(0));
+    auto lhs = column_rows(rows, 0xC01A);
+    const auto rhs = column_rows(rows, 0xC01B);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            lhs[i] += rhs[i];
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::ClobberMemory();
+    }
+    report_rows(state, rows, 3);
+}
+
+static void Column_Less256(benchmark::State & state)
+{
+    const size_t rows = static_cast<size_t>(state.range(0));
+    ColumnRows lhs;
+    ColumnRows rhs;
+    {
+        const auto a = column_rows(rows, 0xC01A);
+        const auto b = column_rows(rows, 0xC01B);
+        lhs = ColumnRows(a.data(), rows);
+        rhs = ColumnRows(b.data(), rows);
+    }
+    std::vector<unsigned char> mask(rows);
+    for (auto _ : state)
+    {
+        less_mask(lhs, rhs, mask.data());
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+    }
+    report_rows(state, rows, 2);
+}
+
+static void Column_Less256Rows(benchmark::State & state)
+{
+    const size_t rows = static_cast<size_t>(state.range(0));
+    const auto lhs = column_rows(rows, 0xC01A);
+    const auto rhs = column_rows(rows, 0xC01B);
+    std::vector<unsigned char> mask(rows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows; ++i)
+            mask[i] = static_cast<unsigned char>(lhs[i] < rhs[i]);
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+    }
+    report_rows(state, rows, 2);
+}
+
+// Aggregation over 32 MiB of WInt values, reported as input bytes per second.
+// The loop baselines are what callers wrote before reduce_*: a widened
+// accumulator for SUM and operator< for MIN.
+constexpr size_t kReduceBytes = size_t(32) << 20;
+constexpr size_t kReduceRows = kReduceBytes / sizeof(WInt);
+using WideSum = gint::integer<kBenchBits + 64, unsigned>;
+
+static const std::vector<WInt> & reduce_data()
+{
+    static const std::vector<WInt> data = []
+    {
+        std::vector<WInt> d(kReduceRows);
+        std::mt19937_64 rng(kSeedBase ^ 0x5EDC'E000ull);
+        for (auto & value : d)
+            value = random_wide<WInt>(rng);
+        return d;
+    }();
+    return data;
+}
+
+static const gint::column<kBenchBits, unsigned> & reduce_column()
+{
+    static const gint::column<kBenchBits, unsigned> rows(reduce_data().data(), kReduceRows);
+    return rows;
+}
+
+static void report_reduce(benchmark::State & state)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kReduceRows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * kReduceBytes));
+}
+
+static void Reduce_Sum(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        WideSum sum = 0;
+        gint::reduce_sum(data.data(), data.size(), sum);
+        benchmark::DoNotOptimize(sum);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_SumLoop(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        WideSum sum = 0;
+        for (const auto & value : data)
+            sum += WideSum(value);
+        benchmark::DoNotOptimize(sum);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_SumColumn(benchmark::State & state)
+{
+    const auto & rows = reduce_column();
+    for (auto _ : state)
+    {
+        WideSum sum = 0;
+        gint::reduce_sum(rows, sum);
+        benchmark::DoNotOptimize(sum);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_Min(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        WInt low = std::numeric_limits<WInt>::max();
+        gint::reduce_min(data.data(), data.size(), low);
+        benchmark::DoNotOptimize(low);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_MinLoop(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        WInt low = std::numeric_limits<WInt>::max();
+        for (const auto & value : data)
+            low = value < low ? value : low;
+        benchmark::DoNotOptimize(low);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_MinColumn(benchmark::State & state)
+{
+    const auto & rows = reduce_column();
+    for (auto _ : state)
+    {
+        WInt low = std::numeric_limits<WInt>::max();
+        gint::reduce_min(rows, low);
+        benchmark::DoNotOptimize(low);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_Max(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        WInt high = 0;
+        gint::reduce_max(data.data(), data.size(), high);
+        benchmark::DoNotOptimize(high);
+    }
+    report_reduce(state);
+}
+
+static void Reduce_Avg(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    for (auto _ : state)
+    {
+        auto average = gint::reduce_avg(data.data(), data.size());
+        benchmark::DoNotOptimize(average);
+    }
+    report_reduce(state);
+}
+
+// Running totals over the same 32 MiB; /partial_sum is std::partial_sum with
+// WInt's operator+.
+static void Scan_Inclusive(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    std::vector<WInt> out(data.size());
+    for (auto _ : state)
+    {
+        gint::inclusive_scan(data.data(), data.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report_reduce(state);
+}
+
+static void Scan_PartialSum(benchmark::State & state)
+{
+    const auto & data = reduce_data();
+    std::vector<WInt> out(data.size());
+    for (auto _ : state)
+    {
+        std::partial_sum(data.begin(), data.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report_reduce(state);
+}
+
+static void Scan_InclusiveColumn(benchmark::State & state)
+{
+    const auto & rows = reduce_column();
+    gint::column<kBenchBits, unsigned> out(rows.size());
+    for (auto _ : state)
+    {
+        gint::inclusive_scan(rows, out);
+        benchmark::DoNotOptimize(out.plane(0));
+        benchmark::ClobberMemory();
+    }
+    report_reduce(state);
+}
+
+// Bucketing 4096 random values against state.range(0) sorted random
+// boundaries; /upper_bound is std::upper_bound per value.
+constexpr size_t kBucketQueries = 4096;
+
+static std::vector<WInt> bucket_values(size_t count, uint64_t seed)
+{
+    std::vector<WInt> values(count);
+    std::mt19937_64 rng(kSeedBase ^ seed);
+    for (auto & value : values)
+        value = random_wide<WInt>(rng);
+    return values;
+}
+
+static void Bucketize_Lookup(benchmark::State & state)
+{
+    std::vector<WInt> boundaries = bucket_values(static_cast<size_t>(state.range(0)), 0xB0CCE7ull);
+    std::sort(boundaries.begin(), boundaries.end());
+    const gint::bucketizer<WInt> buckets(boundaries.data(), boundaries.size());
+    const std::vector<WInt> queries = bucket_values(kBucketQueries, 0x0E51ull);
+    std::vector<size_t> out(kBucketQueries);
+    for (auto _ : state)
+    {
+        buckets.lookup(queries.data(), queries.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kBucketQueries));
+}
+
+static void Bucketize_UpperBound(benchmark::State & state)
+{
+    std::vector<WInt> boundaries = bucket_values(static_cast<size_t>(state.range(0)), 0xB0CCE7ull);
+    std::sort(boundaries.begin(), boundaries.end());
+    const std::vector<WInt> queries = bucket_values(kBucketQueries, 0x0E51ull);
+    std::vector<size_t> out(kBucketQueries);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < queries.size(); ++i)
+            out[i] = static_cast<size_t>(std::upper_bound(boundaries.begin(), boundaries.end(), queries[i]) - boundaries.begin());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kBucketQueries));
+}
+
+// 256 draws per iteration from std::mt19937_64. UniformBelow uses a random
+// full-width bound and UniformBelowSmall 10^30; /modulo reduces random_bits
+// with `%`, which is also biased.
+constexpr size_t kRandomDraws = 256;
+
+static WInt random_bound(bool small)
+{
+    if (small)
+        return WInt(1000000000000000ull) * WInt(1000000000000000ull);
+    std::mt19937_64 rng(kSeedBase ^ 0xB0B0ull);
+    return random_wide<WInt>(rng);
+}
+
+template <bool Small>
+static void Random_UniformBelow(benchmark::State & state)
+{
+    std::mt19937_64 rng(kSeedBase);
+    const WInt bound = random_bound(Small);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRandomDraws; ++i)
+            benchmark::DoNotOptimize(gint::uniform_below(rng, bound));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRandomDraws));
+}
+
+template <bool Small>
+static void Random_Modulo(benchmark::State & state)
+{
+    std::mt19937_64 rng(kSeedBase);
+    const WInt bound = random_bound(Small);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRandomDraws; ++i)
+            benchmark::DoNotOptimize(gint::random_bits<kBenchBits>(rng) % bound);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRandomDraws));
+}
+
+static void Random_Bits(benchmark::State & state)
+{
+    std::mt19937_64 rng(kSeedBase);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRandomDraws; ++i)
+            benchmark::DoNotOptimize(gint::random_bits<kBenchBits>(rng));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRandomDraws));
+}
+
+// Converting 4096 random values of random bit length to double: /cast is
+// static_cast<double>, which reads fegetround(), /batch is gint::to_double.
+constexpr size_t kConvertN = 4096;
+
+static const std::vector<WInt> & convert_values()
+{
+    static const std::vector<WInt> values = []
+    {
+        std::vector<WInt> v(kConvertN);
+        std::mt19937_64 rng(kSeedBase ^ 0xD0B1Eull);
+        for (auto & value : v)
+            value = random_wide<WInt>(rng) >> static_cast<int>(rng() % kBenchBits);
+        return v;
+    }();
+    return values;
+}
+
+static void ToDouble_Cast(benchmark::State & state)
+{
+    const auto & values = convert_values();
+    std::vector<double> out(values.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < values.size(); ++i)
+            out[i] = static_cast<double>(values[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kConvertN));
+}
+
+static void ToDouble_Batch(benchmark::State & state)
+{
+    const auto & values = convert_values();
+    std::vector<double> out(values.size());
+    for (auto _ : state)
+    {
+        gint::to_double(values.data(), values.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kConvertN));
+}
+
+// Converting 4096 doubles of magnitude up to 2^(kBenchBits - 2), signs mixed:
+// /Ctor constructs each value, /Batch is gint::from_double.
+static const std::vector<double> & double_values()
+{
+    static const std::vector<double> values = []
+    {
+        std::vector<double> v(kConvertN);
+        std::mt19937_64 rng(kSeedBase ^ 0xF10A7ull);
+        for (auto & value : v)
+            value = std::ldexp(static_cast<double>(static_cast<int64_t>(rng())), static_cast<int>(rng() % (kBenchBits - 64)) - 63);
+        return v;
+    }();
+    return values;
+}
+
+static void FromDouble_Ctor(benchmark::State & state)
+{
+    const auto & values = double_values();
+    std::vector<gint::integer<kBenchBits, signed>> out(values.size());
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < values.size(); ++i)
+            out[i] = gint::integer<kBenchBits, signed>(values[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kConvertN));
+}
+
+static void FromDouble_Batch(benchmark::State & state)
+{
+    const auto & values = double_values();
+    std::vector<gint::integer<kBenchBits, signed>> out(values.size());
+    for (auto _ : state)
+    {
+        gint::from_double(values.data(), values.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kConvertN));
+}
+
+// Summing kDataN cached values: Throughput adds the whole array per iteration,
+// Latency adds one value and reads the running total back each time. /plus is
+// a WInt accumulated with operator+=.
+static const std::array<WInt, kDataN> & accumulate_data()
+{
+    static const std::array<WInt, kDataN> data = []
+    {
+        std::array<WInt, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0xACC0'5A7Eull);
+        for (auto & value : d)
+            value = random_wide<WInt>(rng);
+        return d;
+    }();
+    return data;
+}
+
+static void Accumulate_Throughput(benchmark::State & state)
+{
+    const auto & data = accumulate_data();
+    for (auto _ : state)
+    {
+        gint::accumulator<kBenchBits, unsigned> sum;
+        for (const auto & value : data)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kDataN));
+}
+
+static void Accumulate_ThroughputPlus(benchmark::State & state)
+{
+    const auto & data = accumulate_data();
+    for (auto _ : state)
+    {
+        WInt sum = 0;
+        for (const auto & value : data)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kDataN));
+}
+
+static void Accumulate_Latency(benchmark::State & state)
+{
+    const auto & data = accumulate_data();
+    gint::accumulator<kBenchBits, unsigned> sum;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        sum += data[i++ & (kDataN - 1)];
+        benchmark::DoNotOptimize(sum.value());
+    }
+}
+
+static void Accumulate_LatencyPlus(benchmark::State & state)
+{
+    const auto & data = accumulate_data();
+    WInt sum = 0;
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        sum += data[i++ & (kDataN - 1)];
+        benchmark::DoNotOptimize(sum);
+    }
+}
+#endif
+
+// -------- Latency --------
+// Dependency-chain variants of the cases above, registered as Latency/<case>
+// with --gint_latency. Each result is ANDed with a zero the compiler cannot
+// see through and XORed into the next left operand, so every operation waits
+// for the previous one while the operands keep the values of the throughput
+// case of the same name. The chain adds one AND and one XOR per limb.
+template <typename Int>
+static Int opaque_zero()
+{
+    Int zero{0};
+    benchmark::DoNotOptimize(zero);
+    return zero;
+}
+
+template <typename Int, typename Data, typename Op>
+static void run_latency(benchmark::State & state, const Data & data, Op op)
+{
+    const Int zero = opaque_zero<Int>();
+    Int last{0};
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        last = op(Int(p.first ^ (last & zero)), p.second);
+    }
+    benchmark::DoNotOptimize(last);
+}
+
+template <typename Int>
+static void Latency_Add_NoCarry(benchmark::State & state)
+{
+    run_latency<Int>(state, add_no_carry_data<Int>(), [](const Int & a, const Int & b) { return Int(a + b); });
+}
+
+template <typename Int>
+static void Latency_Add_FullCarry(benchmark::State & state)
+{
+    run_latency<Int>(state, add_full_carry_data<Int>(), [](const Int & a, const Int & b) { return Int(a + b); });
+}
+
+template <typename Int>
+static void Latency_Sub_NoBorrow(benchmark::State & state)
+{
+    run_latency<Int>(state, sub_no_borrow_data<Int>(), [](const Int & a, const Int & b) { return Int(a - b); });
+}
+
+template <typename Int>
+static void Latency_Sub_FullBorrow(benchmark::State & state)
+{
+    run_latency<Int>(state, sub_full_borrow_data<Int>(), [](const Int & a, const Int & b) { return Int(a - b); });
+}
+
+template <typename Int>
+static void Latency_Mul_U64xU64(benchmark::State & state)
+{
+    run_latency<Int>(state, mul_u64xu64_data<Int>(), [](const Int & a, const Int & b) { return Int(a * b); });
+}
+
+template <typename Int>
+static void Latency_Mul_HighxHigh(benchmark::State & state)
+{
+    run_latency<Int>(state, mul_high_x_high_data<Int>(), [](const Int & a, const Int & b) { return Int(a * b); });
+}
+
+template <typename Int>
+static void Latency_Mul_WideTimesU64(benchmark::State & state)
+{
+    run_latency<Int>(state, mul_wide_times_u64_data<Int>(), [](const Int & a, uint64_t b) { return Int(a * b); });
+}
+
+template <typename Int>
+static void Latency_Div_SmallDivisor32(benchmark::State & state)
+{
+    run_latency<Int>(state, div_small_divisor32_data<Int>(), [](const Int & a, const Int & b) { return Int(a / b); });
+}
+
+template <typename Int>
+static void Latency_Div_SmallDivisor64(benchmark::State & state)
+{
+    run_latency<Int>(state, div_small_divisor64_data<Int>(), [](const Int & a, const Int & b) { return Int(a / b); });
+}
+
+template <typename Int>
+static void Latency_Div_Pow2Divisor(benchmark::State & state)
+{
+    run_latency<Int>(state, div_pow2_divisor_data<Int>(), [](const Int & a, const Int & b) { return Int(a / b); });
+}
+
+template <typename Int>
+static void Latency_Div_SimilarMagnitude(benchmark::State & state)
+{
+    run_latency<Int>(state, div_similar_magnitude_data<Int>(), [](const Int & a, const Int & b) { return Int(a / b); });
+}
+
+template <typename Int>
+static void Latency_Mod_SmallDivisor64(benchmark::State & state)
+{
+    run_latency<Int>(state, mod_small_divisor64_data<Int>(), [](const Int & a, const Int & b) { return Int(a % b); });
+}
+
+template <typename Int>
+static void Latency_Mod_SimilarMagnitude(benchmark::State & state)
+{
+    run_latency<Int>(state, mod_similar_magnitude_data<Int>(), [](const Int & a, const Int & b) { return Int(a % b); });
+}
+
+template <typename Int>
+static void Latency_Shift_LeftVariable(benchmark::State & state)
+{
+    run_latency<Int>(state, shift_left_variable_data<Int>(), [](const Int & a, unsigned b) { return Int(a << b); });
+}
+
+template <typename Int>
+static void Latency_Shift_RightVariable(benchmark::State & state)
+{
+    run_latency<Int>(state, shift_right_variable_data<Int>(), [](const Int & a, unsigned b) { return Int(a >> b); });
+}
+
+template <typename Int>
+static void Latency_Equal_Equal(benchmark::State & state)
+{
+    run_latency<Int>(state, equal_equal_data<Int>(), [](const Int & a, const Int & b) { return Int(uint64_t(a == b)); });
+}
+
+template <typename Int>
+static void Latency_Equal_TopDifferent(benchmark::State & state)
+{
+    run_latency<Int>(
+        state, equal_different_bit_data<Int, kBenchBits - 1>(), [](const Int & a, const Int & b) { return Int(uint64_t(a == b)); });
+}
+
+// Ordering compare on the Equal/LowDifferent operands: they differ only in
+// bit 0, so the result depends on every limb.
+template <typename Int>
+static void Latency_Less_LowDifferent(benchmark::State & state)
+{
+    run_latency<Int>(state, equal_different_bit_data<Int, 0>(), [](const Int & a, const Int & b) { return Int(uint64_t(a < b)); });
+}
+
+// The first character is the last one written, so the next value waits for
+// the whole conversion.
+template <typename Int>
+static void Latency_ToString(benchmark::State & state)
+{
+    const auto & data = to_string_data<Int>();
+    const Int zero = opaque_zero<Int>();
+    Int last{0};
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const std::string text = to_string_convert(Int(data[i++ & (kDataN - 1)] ^ (last & zero)));
+        last = Int(uint64_t(static_cast<unsigned char>(text[0])));
+    }
+    benchmark::DoNotOptimize(last);
+}
+
+#if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
+// The parsed value selects the next input: the index offset is always zero.
+template <typename Int, unsigned Base>
+static void Latency_FromString(benchmark::State & state)
+{
+    static const std::array<std::string, kDataN> data = make_from_string_data<Base>();
+    const Int zero = opaque_zero<Int>();
+    Int last{0};
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const size_t offset = static_cast<size_t>(static_cast<uint64_t>(last & zero));
+        last = gint::from_string<Int>(data[(i++ + offset) & (kDataN - 1)], Base);
+    }
+    benchmark::DoNotOptimize(last);
+}
+#endif
+
+#ifdef GINT_ENABLE_CH_COMPARE
+#    define REG_CASE_CH(Base, Func) gint_bench::register_case(Base "/ClickHouse", &Func<CInt>)
+#else
+#    define REG_CASE_CH(Base, Func)
+#endif
+#ifdef GINT_ENABLE_BOOST_COMPARE
+#    define REG_CASE_BOOST(Base, Func) gint_bench::register_case(Base "/Boost", &Func<BInt>)
+#else
+#    define REG_CASE_BOOST(Base, Func)
+#endif
+#define REG_CASE(Base, Func) \
+    do \
+    { \
+        gint_bench::register_case(Base "/gint", &Func<WInt>); \
+        REG_CASE_CH(Base, Func); \
+        REG_CASE_BOOST(Base, Func); \
+    } while (false)
+
+// Extra cases for the full matrix only
+template <typename Int>
+static void Add_CarryChain64(benchmark::State & state)
+{
+    static std::array<std::pair<Int, Int>, kDataN> data = []
+    {
+        std::array<std::pair<Int, Int>, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0xCC55'DDAA'9988'7766ull);
+        for (size_t i = 0; i < kDataN; ++i)
+        {
+            Int a = random_wide_with_low_limb<Int>(rng, ~0ULL); // low limb all 1s
+            Int b = Int{1};
+            d[i] = {a, b};
+        }
+        return d;
+    }();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        const Int & a = p.first;
+        const Int & b = p.second;
+        benchmark::DoNotOptimize(a + b);
+    }
+}
+
+template <typename Int>
+static void Sub_BorrowChain64(benchmark::State & state)
+{
+    static std::array<std::pair<Int, Int>, kDataN> data = []
+    {
+        std::array<std::pair<Int, Int>, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0x1122'3344'5566'7788ull);
+        for (size_t i = 0; i < kDataN; ++i)
+        {
+            Int a = random_wide_with_low_limb<Int>(rng, 0); // low limb zero
+            Int b = Int{1};
+            d[i] = {a, b};
+        }
+        return d;
+    }();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        const Int & a = p.first;
+        const Int & b = p.second;
+        benchmark::DoNotOptimize(a - b);
+    }
+}
+
+template <typename Int>
+static void Mul_WideTimesU32(benchmark::State & state)
+{
+    static std::array<std::pair<Int, uint32_t>, kDataN> data = []
+    {
+        std::array<std::pair<Int, uint32_t>, kDataN> d{};
+        std::mt19937_64 rng(kSeedBase ^ 0x55AA'AA55'55AA'AA55ull);
+        for (size_t i = 0; i < kDataN; ++i)
+            d[i] = {random_wide<Int>(rng), static_cast<uint32_t>(rng())};
+        return d;
+    }();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto & p = data[i++ & (kDataN - 1)];
+        benchmark::DoNotOptimize(p.first * p.second);
     }
 }
 
@@ -1044,13 +2076,9 @@ static void Div_SimilarMagnitude2(benchmark::State & state)
     }
 }
 
-int main(int argc, char ** argv)
+static void register_cases(const gint_bench::options & flags)
 {
-#if defined(GINT_ENABLE_CH_COMPARE) && defined(GINT_ENABLE_BOOST_COMPARE)
-    if (!verify_comparison_value_domain())
-        return 2;
-#endif
-    bool full_matrix = parse_full_matrix_flag(argc, argv);
+    const bool full_matrix = flags.full;
     // Addition
     REG_CASE("Add/NoCarry", Add_NoCarry);
     REG_CASE("Add/FullCarry", Add_FullCarry);
@@ -1093,22 +2121,23 @@ int main(int argc, char ** argv)
     REG_CASE("ToString/Base10", ToString);
 
 #if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
-    benchmark::RegisterBenchmark("FromString/Base2/gint", &FromString_String<WInt, 2>);
-    benchmark::RegisterBenchmark("FromString/Base8/gint", &FromString_String<WInt, 8>);
-    benchmark::RegisterBenchmark("FromString/Base10/gint", &FromString_String<WInt, 10>);
-    benchmark::RegisterBenchmark("FromString/Base16/gint", &FromString_String<WInt, 16>);
-    benchmark::RegisterBenchmark("FromStringCStr/Base2/gint", &FromString_CStr<WInt, 2>);
-    benchmark::RegisterBenchmark("FromStringCStr/Base8/gint", &FromString_CStr<WInt, 8>);
-    benchmark::RegisterBenchmark("FromStringCStr/Base10/gint", &FromString_CStr<WInt, 10>);
-    benchmark::RegisterBenchmark("FromStringCStr/Base16/gint", &FromString_CStr<WInt, 16>);
-    benchmark::RegisterBenchmark("FromString/ShortBase2/gint", &FromStringShort_String<WInt, 2>);
-    benchmark::RegisterBenchmark("FromString/ShortBase8/gint", &FromStringShort_String<WInt, 8>);
-    benchmark::RegisterBenchmark("FromString/ShortBase10/gint", &FromStringShort_String<WInt, 10>);
-    benchmark::RegisterBenchmark("FromString/ShortBase16/gint", &FromStringShort_String<WInt, 16>);
-    benchmark::RegisterBenchmark("FromStringCStr/ShortBase2/gint", &FromStringShort_CStr<WInt, 2>);
-    benchmark::RegisterBenchmark("FromStringCStr/ShortBase8/gint", &FromStringShort_CStr<WInt, 8>);
-    benchmark::RegisterBenchmark("FromStringCStr/ShortBase10/gint", &FromStringShort_CStr<WInt, 10>);
-    benchmark::RegisterBenchmark("FromStringCStr/ShortBase16/gint", &FromStringShort_CStr<WInt, 16>);
+    gint_bench::register_case("ToChars/Base10/gint", &ToChars<WInt>);
+    gint_bench::register_case("FromString/Base2/gint", &FromString_String<WInt, 2>);
+    gint_bench::register_case("FromString/Base8/gint", &FromString_String<WInt, 8>);
+    gint_bench::register_case("FromString/Base10/gint", &FromString_String<WInt, 10>);
+    gint_bench::register_case("FromString/Base16/gint", &FromString_String<WInt, 16>);
+    gint_bench::register_case("FromStringCStr/Base2/gint", &FromString_CStr<WInt, 2>);
+    gint_bench::register_case("FromStringCStr/Base8/gint", &FromString_CStr<WInt, 8>);
+    gint_bench::register_case("FromStringCStr/Base10/gint", &FromString_CStr<WInt, 10>);
+    gint_bench::register_case("FromStringCStr/Base16/gint", &FromString_CStr<WInt, 16>);
+    gint_bench::register_case("FromString/ShortBase2/gint", &FromStringShort_String<WInt, 2>);
+    gint_bench::register_case("FromString/ShortBase8/gint", &FromStringShort_String<WInt, 8>);
+    gint_bench::register_case("FromString/ShortBase10/gint", &FromStringShort_String<WInt, 10>);
+    gint_bench::register_case("FromString/ShortBase16/gint", &FromStringShort_String<WInt, 16>);
+    gint_bench::register_case("FromStringCStr/ShortBase2/gint", &FromStringShort_CStr<WInt, 2>);
+    gint_bench::register_case("FromStringCStr/ShortBase8/gint", &FromStringShort_CStr<WInt, 8>);
+    gint_bench::register_case("FromStringCStr/ShortBase10/gint", &FromStringShort_CStr<WInt, 10>);
+    gint_bench::register_case("FromStringCStr/ShortBase16/gint", &FromStringShort_CStr<WInt, 16>);
 #endif
 
     if (full_matrix)
@@ -1120,15 +2149,117 @@ int main(int argc, char ** argv)
         REG_CASE("Sub/WideMinusU64", Sub_WideMinusU64);
         REG_CASE("Mul/WideTimesU32", Mul_WideTimesU32);
         REG_CASE("Equal/LowDifferent", Equal_LowDifferent);
+        REG_CASE("Less/LowDifferent", Less_LowDifferent);
         REG_CASE("Div/LargeDivisor128", Div_LargeDivisor128);
         REG_CASE("Div/SimilarMagnitude2", Div_SimilarMagnitude2);
         REG_CASE("DivMod/SimilarMagnitude", DivMod_SimilarMagnitude);
 #if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
-        benchmark::RegisterBenchmark("DivMod/SimilarMagnitudeSeparate/gint", &DivMod_SimilarMagnitudeSeparate<WInt>);
+        gint_bench::register_case("DivMod/SimilarMagnitudeSeparate/gint", &DivMod_SimilarMagnitudeSeparate<WInt>);
+        gint_bench::register_case("Reduce/Sum/gint", &Reduce_Sum);
+        gint_bench::register_case("Reduce/Sum/loop", &Reduce_SumLoop);
+        gint_bench::register_case("Reduce/SumColumn/gint", &Reduce_SumColumn);
+        gint_bench::register_case("Reduce/Min/gint", &Reduce_Min);
+        gint_bench::register_case("Reduce/Min/loop", &Reduce_MinLoop);
+        gint_bench::register_case("Reduce/MinColumn/gint", &Reduce_MinColumn);
+        gint_bench::register_case("Reduce/Max/gint", &Reduce_Max);
+        gint_bench::register_case("Reduce/Avg/gint", &Reduce_Avg);
+        gint_bench::register_case("Scan/Inclusive/gint", &Scan_Inclusive);
+        gint_bench::register_case("Scan/Inclusive/partial_sum", &Scan_PartialSum);
+        gint_bench::register_case("Scan/InclusiveColumn/gint", &Scan_InclusiveColumn);
+        gint_bench::register_case("Bucketize/Lookup/gint", &Bucketize_Lookup)->RangeMultiplier(64)->Range(16, 1 << 20);
+        gint_bench::register_case("Bucketize/Lookup/upper_bound", &Bucketize_UpperBound)->RangeMultiplier(64)->Range(16, 1 << 20);
+        gint_bench::register_case("Random/UniformBelow/gint", &Random_UniformBelow<false>);
+        gint_bench::register_case("Random/UniformBelow/modulo", &Random_Modulo<false>);
+        gint_bench::register_case("Random/UniformBelowSmall/gint", &Random_UniformBelow<true>);
+        gint_bench::register_case("Random/UniformBelowSmall/modulo", &Random_Modulo<true>);
+        gint_bench::register_case("Random/Bits/gint", &Random_Bits);
+        gint_bench::register_case("ToDouble/Cast/gint", &ToDouble_Cast);
+        gint_bench::register_case("ToDouble/Batch/gint", &ToDouble_Batch);
+        gint_bench::register_case("FromDouble/Ctor/gint", &FromDouble_Ctor);
+        gint_bench::register_case("FromDouble/Batch/gint", &FromDouble_Batch);
+        gint_bench::register_case("Accumulate/Throughput/gint", &Accumulate_Throughput);
+        gint_bench::register_case("Accumulate/Throughput/plus", &Accumulate_ThroughputPlus);
+        gint_bench::register_case("Accumulate/Latency/gint", &Accumulate_Latency);
+        gint_bench::register_case("Accumulate/Latency/plus", &Accumulate_LatencyPlus);
+        // Mixed-sign and Q128.128 cases use fixed operand widths; register them
+        // once, and not in perf_benchmark_all_widths where they would carry a
+        // misleading width.
+#if !defined(GINT_BENCH_ALL_WIDTHS)
+        if (kBenchBits == 256)
+        {
+            gint_bench::register_case(
+                "DivMixedSign/Int128ByU64/gint", &DivMixedSign_SignedByUnsigned<gint::Int128, uint64_t>);
+            gint_bench::register_case(
+                "DivMixedSign/Int128ByU128/gint", &DivMixedSign_SignedByUnsigned<gint::Int128, unsigned __int128>);
+            gint_bench::register_case(
+                "DivMixedSign/U128ByInt128/gint", &DivMixedSign_UnsignedBySigned<gint::Int128, unsigned __int128>);
+            gint_bench::register_case(
+                "DivMixedSign/Int256ByU128/gint", &DivMixedSign_SignedByUnsigned<gint::Int256, unsigned __int128>);
+            gint_bench::register_case("FixedMul/Q128.128/gint", &FixedMul_Q128);
+            gint_bench::register_case("FixedMul/Q128.128/manual", &FixedMul_Q128Manual);
+            gint_bench::register_case("FixedDiv/Q128.128/gint", &FixedDiv_Q128);
+            gint_bench::register_case("FixedDiv/Q128.128/manual", &FixedDiv_Q128Manual);
+            gint_bench::register_case("PackedArray/Find160/gint", &PackedArray_Find160);
+            gint_bench::register_case("PackedArray/Find160/vector", &PackedArray_Find160Vector);
+            gint_bench::register_case("PackedArray/Unpack160/gint", &PackedArray_Unpack160);
+            gint_bench::register_case("Column/Add256/gint", &Column_Add256)->Arg(1 << 20)->Arg(1 << 24);
+            gint_bench::register_case("Column/Add256/rows", &Column_Add256Rows)->Arg(1 << 20)->Arg(1 << 24);
+            gint_bench::register_case("Column/Less256/gint", &Column_Less256)->Arg(1 << 20)->Arg(1 << 24);
+            gint_bench::register_case("Column/Less256/rows", &Column_Less256Rows)->Arg(1 << 20)->Arg(1 << 24);
+        }
+#endif
+#endif
+    }
+
+    if (flags.latency)
+    {
+        REG_CASE("Latency/Add/NoCarry", Latency_Add_NoCarry);
+        REG_CASE("Latency/Add/FullCarry", Latency_Add_FullCarry);
+        REG_CASE("Latency/Sub/NoBorrow", Latency_Sub_NoBorrow);
+        REG_CASE("Latency/Sub/FullBorrow", Latency_Sub_FullBorrow);
+        REG_CASE("Latency/Mul/U64xU64", Latency_Mul_U64xU64);
+        REG_CASE("Latency/Mul/HighxHigh", Latency_Mul_HighxHigh);
+        REG_CASE("Latency/Mul/WideTimesU64", Latency_Mul_WideTimesU64);
+        REG_CASE("Latency/Div/SmallDivisor32", Latency_Div_SmallDivisor32);
+        REG_CASE("Latency/Div/SmallDivisor64", Latency_Div_SmallDivisor64);
+        REG_CASE("Latency/Div/Pow2Divisor", Latency_Div_Pow2Divisor);
+        REG_CASE("Latency/Div/SimilarMagnitude", Latency_Div_SimilarMagnitude);
+        REG_CASE("Latency/Mod/SmallDivisor64", Latency_Mod_SmallDivisor64);
+        REG_CASE("Latency/Mod/SimilarMagnitude", Latency_Mod_SimilarMagnitude);
+        REG_CASE("Latency/Equal/Equal", Latency_Equal_Equal);
+        REG_CASE("Latency/Equal/TopDifferent", Latency_Equal_TopDifferent);
+        REG_CASE("Latency/Less/LowDifferent", Latency_Less_LowDifferent);
+        REG_CASE("Latency/Shift/LeftVariable", Latency_Shift_LeftVariable);
+        REG_CASE("Latency/Shift/RightVariable", Latency_Shift_RightVariable);
+        REG_CASE("Latency/ToString/Base10", Latency_ToString);
+#if !defined(GINT_ENABLE_CH_COMPARE) && !defined(GINT_ENABLE_BOOST_COMPARE)
+        gint_bench::register_case("Latency/FromString/Base10/gint", &Latency_FromString<WInt, 10>);
+        gint_bench::register_case("Latency/FromString/Base16/gint", &Latency_FromString<WInt, 16>);
 #endif
     }
+}
 
+#if defined(GINT_BENCH_ALL_WIDTHS)
+} // namespace
+
+namespace gint_bench
+{
+template <>
+void register_width_cases<kBenchBits>(const options & flags)
+{
+    register_cases(flags);
+}
+} // namespace gint_bench
+#else
+int main(int argc, char ** argv)
+{
+#    if defined(GINT_ENABLE_CH_COMPARE) && defined(GINT_ENABLE_BOOST_COMPARE)
+    if (!verify_comparison_value_domain())
+        return 2;
+#    endif
+    register_cases(gint_bench::parse_options(argc, argv));
     benchmark::Initialize(&argc, argv);
     benchmark::RunSpecifiedBenchmarks();
     return 0;
 }
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "perf_counters.h"
+
+// Command-line switches shared by perf_benchmark_int*, perf_compare_int* and
+// perf_benchmark_all_widths, and the registration helper every case goes
+// through.
+namespace gint_bench
+{
+struct options
+{
+    bool full = false;
+    bool latency = false;
+    bool perf_counters = false;
+    // Appended to every registered name; perf_benchmark_all_widths sets
+    // "/bits:<N>" before registering each width.
+    std::string name_suffix;
+};
+
+inline options & current_options()
+{
+    static options value;
+    return value;
+}
+
+inline bool env_flag(const char * name)
+{
+    const char * env = std::getenv(name);
+    return env && (std::string(env) == "1" || std::string(env) == "true");
+}
+
+// --gint_full (GINT_BENCH_FULL=1) adds the granular cases, --gint_latency
+// (GINT_BENCH_LATENCY=1) the Latency/ cases, --gint_perf_counters
+// (GINT_BENCH_PERF_COUNTERS=1) hardware counters on every case.
+inline options & parse_options(int & argc, char **& argv)
+{
+    options & flags = current_options();
+    flags.full = env_flag("GINT_BENCH_FULL");
+    flags.latency = env_flag("GINT_BENCH_LATENCY");
+    flags.perf_counters = env_flag("GINT_BENCH_PERF_COUNTERS");
+    // strip custom flag(s) from argv so Google Benchmark doesn't see them
+    static std::vector<char *> new_argv;
+    new_argv.clear();
+    new_argv.reserve(static_cast<size_t>(argc));
+    for (int i = 0; i < argc; ++i)
+    {
+        std::string s = argv[i] ? argv[i] : "";
+        if (s == "--gint_full" || s == "--gint-full")
+            flags.full = true;
+        else if (s == "--gint_latency" || s == "--gint-latency")
+            flags.latency = true;
+        else if (s == "--gint_perf_counters" || s == "--gint-perf-counters")
+            flags.perf_counters = true;
+        else
+            new_argv.push_back(argv[i]);
+    }
+    argv = new_argv.data();
+    argc = static_cast<int>(new_argv.size());
+    return flags;
+}
+
+// benchmark::RegisterBenchmark with the current name suffix, reading the
+// perf_counters.h counters around the case when --gint_perf_counters is set.
+template <typename Fn>
+auto register_case(const char * name, Fn fn)
+{
+    const options & flags = current_options();
+    const std::string full_name = name + flags.name_suffix;
+    if (!flags.perf_counters)
+        return benchmark::RegisterBenchmark(full_name.c_str(), fn);
+    return benchmark::RegisterBenchmark(
+        full_name.c_str(), [fn](benchmark::State & state) { perf_counters::instance().run(state, fn); });
+}
+
+// Defined by each GINT_BENCH_ALL_WIDTHS build of benchmark_int256.cpp.
+template <size_t Bits>
+void register_width_cases(const options & flags);
+} // namespace gint_bench
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gint/parallel.h>
+
+// Thread scaling of <gint/parallel.h> on 4M Int256 values (128 MiB). Each
+// case takes the thread count as its argument, from 1 up to the hardware
+// concurrency; compare items_per_second across the rows of one case.
+namespace
+{
+using Int = gint::Int256;
+using WideSum = gint::integer<320, signed>;
+constexpr size_t kRows = size_t(1) << 22;
+
+const std::vector<Int> & data()
+{
+    static const std::vector<Int> values = []
+    {
+        std::vector<Int> v(kRows);
+        std::mt19937_64 rng(0x9E3779B97F4A7C15ull);
+        for (Int & value : v)
+            value = (Int(rng()) << 192) | (Int(rng()) << 128) | (Int(rng()) << 64) | Int(rng());
+        return v;
+    }();
+    return values;
+}
+
+unsigned threads_of(const benchmark::State & state)
+{
+    return static_cast<unsigned>(state.range(0));
+}
+
+void report(benchmark::State & state)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void Parallel_Sum(benchmark::State & state)
+{
+    const auto & values = data();
+    for (auto _ : state)
+    {
+        WideSum sum = 0;
+        gint::parallel::reduce_sum(values.data(), values.size(), sum, threads_of(state));
+        benchmark::DoNotOptimize(sum);
+    }
+    report(state);
+}
+
+void Parallel_MulScalar(benchmark::State & state)
+{
+    const auto & values = data();
+    std::vector<Int> out(values.size());
+    for (auto _ : state)
+    {
+        gint::parallel::transform_mul_scalar(values.data(), values.size(), Int(1000000007), out.data(), threads_of(state));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+void Parallel_DivideBy(benchmark::State & state)
+{
+    const auto & values = data();
+    std::vector<Int> out(values.size());
+    const Int divisor = (Int(1) << 100) + Int(12345);
+    for (auto _ : state)
+    {
+        gint::parallel::divide_all_by(values.data(), values.size(), divisor, out.data(), threads_of(state));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+void Parallel_InclusiveScan(benchmark::State & state)
+{
+    const auto & values = data();
+    std::vector<Int> out(values.size());
+    for (auto _ : state)
+    {
+        gint::parallel::inclusive_scan(values.data(), values.size(), out.data(), Int(0), threads_of(state));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+void Parallel_ToChars(benchmark::State & state)
+{
+    constexpr size_t width = 80;
+    const auto & values = data();
+    std::vector<char> text(values.size() * width);
+    std::vector<gint::to_chars_result> results(values.size());
+    for (auto _ : state)
+    {
+        gint::parallel::to_chars_all(values.data(), values.size(), text.data(), width, results.data(), threads_of(state));
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    report(state);
+}
+
+void thread_counts(benchmark::internal::Benchmark * bench)
+{
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads < hardware; threads *= 2)
+        bench->Arg(threads);
+    bench->Arg(hardware);
+    bench->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+} // namespace
+
+BENCHMARK(Parallel_Sum)->Name("Parallel/Sum")->Apply(thread_counts);
+BENCHMARK(Parallel_MulScalar)->Name("Parallel/MulScalar")->Apply(thread_counts);
+BENCHMARK(Parallel_DivideBy)->Name("Parallel/DivideBy")->Apply(thread_counts);
+BENCHMARK(Parallel_InclusiveScan)->Name("Parallel/InclusiveScan")->Apply(thread_counts);
+BENCHMARK(Parallel_ToChars)->Name("Parallel/ToChars")->Apply(thread_counts);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <gint/gint.h>
+
+// The widths above 1024 bits, whose products and quotients run the
+// runtime-length kernels instead of the fixed-width ones: truncated operator*
+// and the full product behind fixed multiplication (both Karatsuba from 2048
+// bits), and division by a divisor half as wide as the dividend. Each row
+// works through kRows random operand pairs per iteration.
+namespace
+{
+constexpr size_t kRows = 64;
+
+template <typename Int>
+std::vector<Int> random_values(size_t limbs, uint64_t seed)
+{
+    std::vector<Int> values(kRows);
+    std::mt19937_64 rng(seed);
+    for (Int & value : values)
+    {
+        value = 0;
+        for (size_t i = 0; i < limbs; ++i)
+            value = (value << 64) | Int(rng());
+    }
+    return values;
+}
+
+// out[i] = a[i] * b[i], low Bits of the product.
+template <size_t Bits>
+void Mul(benchmark::State & state)
+{
+    using Int = gint::integer<Bits, unsigned>;
+    const auto a = random_values<Int>(Int::limbs, 1);
+    const auto b = random_values<Int>(Int::limbs, 2);
+    std::vector<Int> out(kRows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+// fixed<Bits, Bits / 2> products, which need the full 2 * Bits-bit product.
+template <size_t Bits>
+void FixedMul(benchmark::State & state)
+{
+    using Int = gint::integer<Bits, unsigned>;
+    using Fixed = gint::fixed<Bits, Bits / 2, unsigned>;
+    const auto a = random_values<Int>(Int::limbs, 3);
+    const auto b = random_values<Int>(Int::limbs, 4);
+    std::vector<Fixed> out(kRows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = Fixed::from_raw(a[i]) * Fixed::from_raw(b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+// out[i] = a[i] / d[i] with d[i] half as wide as a[i].
+template <size_t Bits>
+void Div(benchmark::State & state)
+{
+    using Int = gint::integer<Bits, unsigned>;
+    const auto a = random_values<Int>(Int::limbs, 5);
+    const auto d = random_values<Int>(Int::limbs / 2, 6);
+    std::vector<Int> out(kRows);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < kRows; ++i)
+            out[i] = a[i] / d[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(Mul, 2048)->Name("Wide/Mul/2048");
+BENCHMARK_TEMPLATE(Mul, 4096)->Name("Wide/Mul/4096");
+BENCHMARK_TEMPLATE(FixedMul, 2048)->Name("Wide/FixedMul/2048");
+BENCHMARK_TEMPLATE(Div, 2048)->Name("Wide/Div/2048");
+BENCHMARK_TEMPLATE(Div, 4096)->Name("Wide/Div/4096");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+#if defined(__linux__)
+#    include <cstring>
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+// Minimal Linux perf_event_open reader for the benchmark binaries. One event
+// group counts user-space cycles, instructions, branch misses and L1D read
+// misses of the calling thread; run() reads the group around a benchmark
+// function and reports the deltas per iteration as user counters. Events the
+// kernel or the machine refuses are left out, and when not even cycles can be
+// opened (no PMU in the VM, perf_event_paranoid, seccomp, non-Linux) run()
+// prints one warning and reports nothing.
+namespace gint_bench
+{
+class perf_counters
+{
+public:
+    static perf_counters & instance()
+    {
+        static perf_counters counters;
+        return counters;
+    }
+
+    bool available() const { return count_ > 0; }
+
+    // The deltas include whatever the function does outside its timed loop;
+    // that setup is amortized over the iterations of the reported run.
+    template <typename Fn>
+    void run(benchmark::State & state, Fn && fn)
+    {
+        if (!available())
+        {
+            warn_once();
+            fn(state);
+            return;
+        }
+        sample before;
+        const bool ok_before = read(before);
+        fn(state);
+        sample after;
+        if (!ok_before || !read(after) || state.iterations() == 0)
+            return;
+        // The group did not get onto the PMU during the run, so there is
+        // nothing to extrapolate from: report the counters as unavailable.
+        if (after.time_running <= before.time_running || after.time_enabled < before.time_enabled)
+            return;
+        // Scale the raw deltas by the enabled/running ratio of the run itself
+        // when the kernel multiplexed the group.
+        const double scale = static_cast<double>(after.time_enabled - before.time_enabled)
+            / static_cast<double>(after.time_running - before.time_running);
+        double values[kEvents] = {};
+        for (size_t i = 0; i < count_; ++i)
+        {
+            const uint64_t delta = after.value[i] > before.value[i] ? after.value[i] - before.value[i] : 0;
+            values[slot_[i]] = static_cast<double>(delta) * scale;
+            state.counters[names()[slot_[i]]] = benchmark::Counter(values[slot_[i]], benchmark::Counter::kAvgIterations);
+        }
+        if (values[kCycles] > 0 && has(kInstructions))
+            state.counters["IPC"] = values[kInstructions] / values[kCycles];
+    }
+
+private:
+    enum event
+    {
+        kCycles,
+        kInstructions,
+        kBranchMisses,
+        kL1dMisses,
+        kEvents
+    };
+
+    // Raw counts and the group's enabled/running times, as read().
+    struct sample
+    {
+        uint64_t time_enabled;
+        uint64_t time_running;
+        uint64_t value[kEvents];
+    };
+
+    static const char * const * names()
+    {
+        static const char * const table[kEvents] = {"cycles", "instructions", "branch_misses", "l1d_misses"};
+        return table;
+    }
+
+    bool has(event e) const
+    {
+        for (size_t i = 0; i < count_; ++i)
+            if (slot_[i] == e)
+                return true;
+        return false;
+    }
+
+    void warn_once()
+    {
+        if (warned_)
+            return;
+        warned_ = true;
+        std::fprintf(stderr, "warning: hardware performance counters are unavailable; --gint_perf_counters is ignored\n");
+    }
+
+#if defined(__linux__)
+    perf_counters()
+    {
+        const std::pair<uint32_t, uint64_t> events[kEvents] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE,
+             PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        };
+        for (size_t e = 0; e < kEvents; ++e)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[e].first;
+            attr.config = events[e].second;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = leader_ < 0 ? 1 : 0;
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0);
+            if (fd < 0)
+            {
+                // Without cycles there is no group to join.
+                if (e == kCycles)
+                    return;
+                continue;
+            }
+            if (leader_ < 0)
+                leader_ = static_cast<int>(fd);
+            fd_[count_] = static_cast<int>(fd);
+            slot_[count_] = static_cast<event>(e);
+            ++count_;
+        }
+        if (ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0)
+            close_all();
+    }
+
+    ~perf_counters() { close_all(); }
+
+    void close_all()
+    {
+        for (size_t i = 0; i < count_; ++i)
+            close(fd_[i]);
+        count_ = 0;
+        leader_ = -1;
+    }
+
+    bool read(sample & out) const
+    {
+        uint64_t buffer[3 + kEvents];
+        const ssize_t expected = static_cast<ssize_t>((3 + count_) * sizeof(uint64_t));
+        if (::read(leader_, buffer, sizeof(buffer)) != expected || buffer[0] != count_)
+            return false;
+        out.time_enabled = buffer[1];
+        out.time_running = buffer[2];
+        for (size_t i = 0; i < count_; ++i)
+            out.value[i] = buffer[3 + i];
+        return true;
+    }
+
+    int fd_[kEvents] = {};
+#else
+    perf_counters() = default;
+
+    bool read(sample &) const { return false; }
+#endif
+
+    int leader_ = -1;
+    event slot_[kEvents] = {};
+    size_t count_ = 0;
+    bool warned_ = false;
+};
+} // namespace gint_bench
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iosfwd>
 #include <limits>
@@ -36,10 +37,11 @@
 #include <type_traits>
 
 #ifndef GINT_DETAIL_CORE_ONLY
-#    include <cstring>
 #    include <ios>
 #    include <ostream>
 #    include <string>
+#    include <system_error>
+#    include <vector>
 #endif
 
 #if defined(GINT_ENABLE_FMT) && !defined(GINT_DETAIL_CORE_ONLY)
@@ -107,6 +109,23 @@
 #    define GINT_DIVZERO_CHECK(cond) GINT_ZERO_CHECK(cond, "division by zero")
 #    define GINT_MODZERO_CHECK(cond) GINT_ZERO_CHECK(cond, "modulo by zero")
 
+#    if defined(GINT_ENABLE_DIVISION_CACHE)
+#        define GINT_DETAIL_DIVISION_CACHE 1
+#    else
+#        define GINT_DETAIL_DIVISION_CACHE 0
+#    endif
+
+#    if defined(GINT_ENABLE_PATH_STATS)
+#        define GINT_DETAIL_PATH_STATS 1
+#        define GINT_COUNT_PATH(counter) (++::gint::detail::path_stats_counters().counter)
+#    else
+#        define GINT_DETAIL_PATH_STATS 0
+#        define GINT_COUNT_PATH(counter) \
+            do \
+            { \
+            } while (false)
+#    endif
+
 #    if __cplusplus >= 201402L
 #        define GINT_CONSTEXPR14 constexpr
 #    else
@@ -145,8 +164,8 @@
 
 // Public configuration boundary:
 // - User-facing switches are GINT_ENABLE_FMT, GINT_ENABLE_DIVZERO_CHECKS,
-//   GINT_GCC_TUNED_PATHS, GINT_CLANG_TUNED_PATHS, and
-//   GINT_ENABLE_AARCH64_LIMB_ASM.
+//   GINT_ENABLE_DIVISION_CACHE, GINT_ENABLE_PATH_STATS, GINT_GCC_TUNED_PATHS,
+//   GINT_CLANG_TUNED_PATHS, and GINT_ENABLE_AARCH64_LIMB_ASM.
 // - Fast paths are governed internally by the four platform policies below.
 //   Keep one-off compiler defect checks separate from algorithm selection.
 #    ifndef GINT_ENABLE_AARCH64_LIMB_ASM
@@ -253,13 +272,15 @@
 // The inline namespace is invisible at the source level (`gint::integer` keeps
 // working), while differently configured translation units get distinct
 // symbols instead of linker-order-dependent COMDAT selection.
-#    define GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
-        config_d##divzero##_g##gcc_tuned##_c##clang_tuned##_a##aarch64_asm##_e##exceptions
-#    define GINT_DETAIL_CONFIG_NAMESPACE_II(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
-        GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions)
+#    define GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
+        config_d##divzero##_r##cache##_s##stats##_g##gcc_tuned##_c##clang_tuned##_a##aarch64_asm##_e##exceptions
+#    define GINT_DETAIL_CONFIG_NAMESPACE_II(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
+        GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions)
 #    define GINT_DETAIL_CONFIG_NAMESPACE \
         GINT_DETAIL_CONFIG_NAMESPACE_II( \
             GINT_DETAIL_DIVZERO_CHECKS, \
+            GINT_DETAIL_DIVISION_CACHE, \
+            GINT_DETAIL_PATH_STATS, \
             GINT_DETAIL_GCC_TUNED_POLICY, \
             GINT_DETAIL_CLANG_TUNED_POLICY, \
             GINT_DETAIL_AARCH64_ASM_POLICY, \
@@ -279,6 +300,51 @@ using UInt128 = integer<128, unsigned>;
 using Int256 = integer<256, signed>;
 using UInt256 = integer<256, unsigned>;
 
+/// Rounding applied when a conversion or fixed-point operation discards bits.
+enum class rounding
+{
+    toward_zero,
+    to_nearest, ///< Ties to even.
+    downward,
+    upward
+};
+
+/// Per-thread counters of the divisor cache enabled by `GINT_ENABLE_DIVISION_CACHE`.
+struct division_cache_stats
+{
+    uint64_t hits;
+    uint64_t misses;
+};
+
+namespace stats
+{
+/// Number of length buckets in `counters`. Bucket `i` counts lengths whose bit
+/// width is `i` (0, 1, 2-3, 4-7, ...); the last bucket also takes every longer
+/// length.
+constexpr size_t length_buckets = 12;
+
+/// Per-thread dispatch counters of the mode enabled by `GINT_ENABLE_PATH_STATS`.
+/// Each division field counts entries into one kernel, so an operation that
+/// widens or narrows before dividing can count more than once.
+struct counters
+{
+    uint64_t power_of_two;         ///< Shift or mask for a power-of-two divisor.
+    uint64_t single_limb;          ///< `div_mod_small` / `mod_small` by a one-limb divisor.
+    uint64_t int128;               ///< `div_128` between 128-bit operands.
+    uint64_t two_limb;             ///< `div_large_2`.
+    uint64_t three_limb;           ///< `div_large_3`.
+    uint64_t four_limb;            ///< `div_large_4` / `rem_large_4` at 256 bits.
+    uint64_t single_quotient_limb; ///< Divisor one limb narrower than the dividend or less.
+    uint64_t knuth;                ///< Generic Knuth division of a one- or two-limb quotient.
+    uint64_t reciprocal;           ///< 3-by-2 reciprocal division of a longer quotient.
+    uint64_t cached;               ///< Divisor served by `GINT_ENABLE_DIVISION_CACHE`.
+    uint64_t promoted;             ///< Unsigned builtin operand outside the signed range.
+    uint64_t parse_base[37];       ///< `parse_string_range` calls by resolved base.
+    uint64_t parse_length[length_buckets];     ///< `parse_string_range` digit counts.
+    uint64_t to_string_length[length_buckets]; ///< `to_string` output lengths, sign included.
+};
+} // namespace stats
+
 //=== Internal helper utilities ==============================================
 namespace detail
 {
@@ -287,22 +353,38 @@ template <size_t Bits, typename Signed>
 struct integer_test_access;
 #    endif
 
+struct limb_access;
+
 template <size_t Bits, typename Signed>
 integer<Bits, Signed> parse_string_range(const char * begin, const char * end, unsigned base);
 
 template <unsigned BitsPerDigit, size_t Bits, typename Signed>
 integer<Bits, Signed> parse_power_of_two_range(const char * begin, const char * end);
 
+#    if GINT_DETAIL_PATH_STATS
+inline stats::counters & path_stats_counters() noexcept
+{
+    static thread_local stats::counters counters = {};
+    return counters;
+}
+
+inline size_t path_stats_length_bucket(size_t length) noexcept
+{
+    const size_t width = length == 0 ? 0 : 64 - static_cast<size_t>(__builtin_clzll(static_cast<unsigned long long>(length)));
+    return width < stats::length_buckets ? width : stats::length_buckets - 1;
+}
+#    endif
+
 template <size_t Bits>
 struct storage_count
 {
     static_assert(Bits >= 64, "Bits must be at least 64");
-    static_assert(Bits <= 1024, "Bits must be at most 1024");
-    static_assert((Bits & (Bits - 1)) == 0, "Bits must be a power of two");
+    static_assert(Bits <= 4096, "Bits must be at most 4096");
+    static_assert(Bits % 64 == 0, "Bits must be a multiple of 64");
     static constexpr size_t value = Bits / 64;
 };
 
-template <size_t Bits, bool NeedsLimit = (Bits < 256)>
+template <size_t Bits, bool NeedsLimit = (Bits <= 128)>
 struct signed_promotion_limit;
 
 template <size_t Bits>
@@ -333,6 +415,47 @@ struct make_index_sequence<0, I...>
     using type = index_sequence<I...>;
 };
 
+// Whether a truncated magnitude must be bumped by one unit. guard is the
+// first discarded bit (or "remainder at least half"), sticky whether anything
+// beyond an exact half was discarded.
+constexpr bool round_magnitude_away(rounding mode, bool negative, bool lsb, bool guard, bool sticky) noexcept
+{
+    return mode == rounding::to_nearest ? guard && (sticky || lsb)
+        : mode == rounding::upward      ? !negative && (guard || sticky)
+        : mode == rounding::downward    ? negative && (guard || sticky)
+                                        : false;
+}
+
+// The fegetround() mode as a rounding.
+inline rounding current_rounding() noexcept
+{
+    switch (std::fegetround())
+    {
+        case FE_UPWARD:
+            return rounding::upward;
+        case FE_DOWNWARD:
+            return rounding::downward;
+        case FE_TOWARDZERO:
+            return rounding::toward_zero;
+        default:
+            return rounding::to_nearest;
+    }
+}
+
+// Unsigned type holding the bits of an IEEE binary32 or binary64 Float, or
+// void for formats that are converted through ldexp.
+template <typename Float>
+struct binary_float_bits
+{
+    using type = typename std::conditional<
+        std::numeric_limits<Float>::is_iec559 && std::numeric_limits<Float>::digits == 24 && sizeof(Float) == 4,
+        uint32_t,
+        typename std::conditional<
+            std::numeric_limits<Float>::is_iec559 && std::numeric_limits<Float>::digits == 53 && sizeof(Float) == 8,
+            uint64_t,
+            void>::type>::type;
+};
+
 // These custom type traits extend std::is_integral / std::is_signed / std::is_unsigned
 // to support the GCC-specific built-in types __int128 and unsigned __int128 in
 // strict -std=c++11 mode.
@@ -444,6 +567,199 @@ inline unsigned __int128 mulhi_u128_no_middle_wrap(unsigned __int128 a, unsigned
     const unsigned __int128 s = (t0 >> 64) + t1 + t2;
     return t3 + (s >> 64);
 }
+
+// Compile-time reciprocals for constant divisors, following Moller and
+// Granlund, "Improved division by invariant integers". Divisors are
+// normalized so their top bit is set; the stored reciprocal omits the
+// implicit leading 2^64 term.
+constexpr unsigned constant_leading_zeros(uint64_t v, unsigned n = 0) noexcept
+{
+    return (v >> 63) != 0 ? n : constant_leading_zeros(v << 1, n + 1);
+}
+
+// One step of the 192/128-bit long division of 2^192 - 1 by a normalized
+// two-limb divisor: shift in the next all-ones dividend bit.
+constexpr unsigned __int128 reciprocal_3by2_next_rem(unsigned __int128 rem, unsigned __int128 d) noexcept
+{
+    return ((rem >> 127) != 0 || ((rem << 1) | 1) >= d) ? ((rem << 1) | 1) - d : ((rem << 1) | 1);
+}
+
+constexpr uint64_t reciprocal_3by2_bits(unsigned __int128 rem, unsigned __int128 d, unsigned remaining, uint64_t q) noexcept
+{
+    return remaining == 0 ? q
+                          : reciprocal_3by2_bits(
+                                reciprocal_3by2_next_rem(rem, d),
+                                d,
+                                remaining - 1,
+                                (q << 1) | (((rem >> 127) != 0 || ((rem << 1) | 1) >= d) ? 1 : 0));
+}
+
+// floor((2^192 - 1) / d) - 2^64 for a normalized 128-bit d. The leading
+// 128 dividend bits contribute exactly one quotient bit with remainder ~d.
+constexpr uint64_t reciprocal_3by2(unsigned __int128 d) noexcept
+{
+    return reciprocal_3by2_bits(~d, d, 64, 0);
+}
+
+template <uint64_t Divisor>
+struct constant_divisor_u64
+{
+    static_assert(Divisor != 0, "constant divisor must be non-zero");
+    static constexpr bool power_of_two = (Divisor & (Divisor - 1)) == 0;
+    static constexpr unsigned shift = constant_leading_zeros(Divisor);
+    static constexpr uint64_t normalized = Divisor << shift;
+    // floor((2^128 - 1) / normalized) lies in [2^64, 2^65); truncation drops 2^64.
+    static constexpr uint64_t reciprocal = static_cast<uint64_t>(~static_cast<unsigned __int128>(0) / normalized);
+};
+
+template <uint64_t High, uint64_t Low>
+struct constant_divisor_u128
+{
+    static_assert(High != 0, "two-limb constant divisor must have a non-zero high limb");
+    static constexpr unsigned shift = constant_leading_zeros(High);
+    static constexpr unsigned __int128 normalized = ((static_cast<unsigned __int128>(High) << 64) | Low) << shift;
+    static constexpr uint64_t reciprocal = reciprocal_3by2(normalized);
+};
+
+// Compile-time powers of ten as little-endian limb rows. Each row scales an
+// earlier one by at most 10^19, so instantiation depth stays near K / 19.
+template <size_t L>
+struct limb_row
+{
+    uint64_t limb[L];
+};
+
+constexpr uint64_t pow10_u64(size_t k) noexcept
+{
+    return k == 0 ? 1 : 10 * pow10_u64(k - 1);
+}
+
+// Carry flowing into limb j when row is multiplied by m.
+template <size_t L>
+constexpr uint64_t scale_row_carry(const limb_row<L> & row, uint64_t m, size_t j) noexcept
+{
+    return j == 0 ? 0 : static_cast<uint64_t>((static_cast<unsigned __int128>(row.limb[j - 1]) * m + scale_row_carry(row, m, j - 1)) >> 64);
+}
+
+template <size_t L, size_t... J>
+constexpr limb_row<L> scale_row(const limb_row<L> & row, uint64_t m, index_sequence<J...>) noexcept
+{
+    return limb_row<L>{{static_cast<uint64_t>(static_cast<unsigned __int128>(row.limb[J]) * m + scale_row_carry(row, m, J))...}};
+}
+
+template <size_t L, size_t K>
+struct pow10_row
+{
+    static constexpr size_t step = K < 19 ? K : 19;
+    static constexpr limb_row<L> value = scale_row(pow10_row<L, K - step>::value, pow10_u64(step), typename make_index_sequence<L>::type());
+};
+
+template <size_t L>
+struct pow10_row<L, 0>
+{
+    static constexpr limb_row<L> value = {{1}};
+};
+
+template <size_t L, size_t Stride, typename Seq>
+struct pow10_rows;
+
+template <size_t L, size_t Stride, size_t... K>
+struct pow10_rows<L, Stride, index_sequence<K...>>
+{
+    static constexpr limb_row<L> value[sizeof...(K)] = {pow10_row<L, K * Stride>::value...};
+};
+
+// 10^0 .. 10^max_exponent, where max_exponent = floor(Bits * log10(2)) is the
+// largest power of ten representable in Bits. 30103 / 100000 agrees with the
+// exact floor for every multiple of 64 up to 8192. Above 1024 bits only every
+// 19th power is stored; callers scale the row by the remaining 10^(k % 19).
+template <size_t Bits>
+struct pow10_table
+{
+    static constexpr size_t limbs = Bits / 64;
+    static constexpr size_t max_exponent = Bits * 30103 / 100000;
+    static constexpr size_t stride = Bits <= 1024 ? 1 : 19;
+    using rows = pow10_rows<limbs, stride, typename make_index_sequence<max_exponent / stride + 1>::type>;
+};
+
+#    if __cplusplus < 201703L
+template <size_t L, size_t K>
+constexpr limb_row<L> pow10_row<L, K>::value;
+
+template <size_t L>
+constexpr limb_row<L> pow10_row<L, 0>::value;
+
+template <size_t L, size_t Stride, size_t... K>
+constexpr limb_row<L> pow10_rows<L, Stride, index_sequence<K...>>::value[sizeof...(K)];
+#    endif
+
+// Estimate floor(log10(x)) from bit_width(x), never below the true value and
+// at most one above: floor(width * log10(2)), with log10(2) approximated by
+// 646456993 / 2^31. The common 1233 / 4096 approximation drifts at width 681.
+constexpr size_t decimal_exponent_estimate(size_t width) noexcept
+{
+    return static_cast<size_t>((static_cast<uint64_t>(width) * 646456993ULL) >> 31);
+}
+
+// Baseline x86_64 has no POPCNT instruction and the builtin lowers to a
+// libgcc call there, so fall back to the SWAR reduction.
+GINT_CONSTEXPR14 inline int popcount64(uint64_t v) noexcept
+{
+#    if GINT_ARCH_X86_64 && !defined(__POPCNT__)
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((v * 0x0101010101010101ULL) >> 56);
+#    else
+    return __builtin_popcountll(v);
+#    endif
+}
+
+// 2-by-1 division of (u1, u0) by a normalized d with u1 < d.
+GINT_CONSTEXPR14 inline uint64_t div_2by1_preinv(uint64_t u1, uint64_t u0, uint64_t d, uint64_t v, uint64_t & rem) noexcept
+{
+    const unsigned __int128 p = static_cast<unsigned __int128>(v) * u1 + ((static_cast<unsigned __int128>(u1) << 64) | u0);
+    uint64_t q = static_cast<uint64_t>(p >> 64) + 1;
+    uint64_t r = u0 - q * d;
+    if (r > static_cast<uint64_t>(p))
+    {
+        --q;
+        r += d;
+    }
+    if (GINT_UNLIKELY(r >= d))
+    {
+        ++q;
+        r -= d;
+    }
+    rem = r;
+    return q;
+}
+
+// 3-by-2 division of (u2, u1, u0) by a normalized two-limb d with (u2, u1) < d.
+GINT_CONSTEXPR14 inline uint64_t
+div_3by2_preinv(uint64_t u2, uint64_t u1, uint64_t u0, unsigned __int128 d, uint64_t v, unsigned __int128 & rem) noexcept
+{
+    using u128 = unsigned __int128;
+    const uint64_t d1 = static_cast<uint64_t>(d >> 64);
+    const uint64_t d0 = static_cast<uint64_t>(d);
+    const u128 p = static_cast<u128>(v) * u2 + ((static_cast<u128>(u2) << 64) | u1);
+    uint64_t q = static_cast<uint64_t>(p >> 64);
+    const uint64_t r1 = u1 - q * d1;
+    u128 r = ((static_cast<u128>(r1) << 64) | u0) - static_cast<u128>(d0) * q - d;
+    ++q;
+    if (static_cast<uint64_t>(r >> 64) >= static_cast<uint64_t>(p))
+    {
+        --q;
+        r += d;
+    }
+    if (GINT_UNLIKELY(r >= d))
+    {
+        ++q;
+        r -= d;
+    }
+    rem = r;
+    return q;
+}
 // Add two 64-bit unsigned values and accumulate carry count (0 or 1) into c.
 // Returns the 64-bit sum; c is incremented if overflow occurs.
 inline uint64_t addc64(uint64_t a, uint64_t b, uint64_t & c) noexcept
@@ -465,6 +781,9 @@ GINT_FORCE_INLINE void add_limbs_copy_runtime<1>(uint64_t * dst, const uint64_t
 template <>
 GINT_FORCE_INLINE void add_limbs_copy_runtime<2>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
 
+template <>
+GINT_FORCE_INLINE void add_limbs_copy_runtime<3>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
+
 template <>
 GINT_FORCE_INLINE void add_limbs_copy_runtime<4>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
 
@@ -477,6 +796,9 @@ GINT_FORCE_INLINE void sub_limbs_copy_runtime(uint64_t * dst, const uint64_t * l
 template <>
 GINT_FORCE_INLINE void sub_limbs_copy_runtime<2>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
 
+template <>
+GINT_FORCE_INLINE void sub_limbs_copy_runtime<3>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
+
 template <>
 GINT_FORCE_INLINE void sub_limbs_copy_runtime<4>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept;
 
@@ -531,6 +853,19 @@ GINT_FORCE_INLINE void add_limbs_copy_runtime<2>(uint64_t * dst, const uint64_t
     add_limbs_copy_scalar<2>(dst, lhs, rhs);
 }
 
+// 192-bit: one 128-bit add for the low pair and a single limb for the top.
+template <>
+GINT_FORCE_INLINE void add_limbs_copy_runtime<3>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+    using u128 = unsigned __int128;
+    const u128 lo_a = (u128(lhs[1]) << 64) | lhs[0];
+    const u128 lo_b = (u128(rhs[1]) << 64) | rhs[0];
+    const u128 lo_sum = lo_a + lo_b;
+    dst[0] = static_cast<uint64_t>(lo_sum);
+    dst[1] = static_cast<uint64_t>(lo_sum >> 64);
+    dst[2] = lhs[2] + rhs[2] + static_cast<uint64_t>(lo_sum < lo_a);
+}
+
 template <>
 GINT_FORCE_INLINE void add_limbs_copy_runtime<4>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept
 {
@@ -649,6 +984,18 @@ GINT_FORCE_INLINE void sub_limbs_copy_runtime<2>(uint64_t * dst, const uint64_t
     sub_limbs_copy_scalar<2>(dst, lhs, rhs);
 }
 
+template <>
+GINT_FORCE_INLINE void sub_limbs_copy_runtime<3>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+    using u128 = unsigned __int128;
+    const u128 lo_a = (u128(lhs[1]) << 64) | lhs[0];
+    const u128 lo_b = (u128(rhs[1]) << 64) | rhs[0];
+    const u128 lo_diff = lo_a - lo_b;
+    dst[0] = static_cast<uint64_t>(lo_diff);
+    dst[1] = static_cast<uint64_t>(lo_diff >> 64);
+    dst[2] = lhs[2] - rhs[2] - static_cast<uint64_t>(lo_a < lo_b);
+}
+
 template <>
 GINT_FORCE_INLINE void sub_limbs_copy_runtime<4>(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs) noexcept
 {
@@ -1033,6 +1380,61 @@ GINT_FORCE_INLINE void mul_limbs<2>(uint64_t * res, const uint64_t * lhs, const
     res[1] = static_cast<uint64_t>(sum1);
 }
 
+// Low 192 bits of a 3-limb product. Only the first two columns need their
+// carries; the third keeps the low halves of its three partial products.
+template <>
+GINT_FORCE_INLINE void mul_limbs<3>(uint64_t * res, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+    using u128 = unsigned __int128;
+    const u128 p00 = u128(lhs[0]) * rhs[0];
+    const u128 col1 = (p00 >> 64) + u128(lhs[0]) * rhs[1];
+    const u128 p10 = u128(lhs[1]) * rhs[0];
+    const u128 sum1 = col1 + p10;
+    res[0] = static_cast<uint64_t>(p00);
+    res[1] = static_cast<uint64_t>(sum1);
+    res[2] = static_cast<uint64_t>(sum1 >> 64) + lhs[0] * rhs[2] + lhs[1] * rhs[1] + lhs[2] * rhs[0];
+}
+
+// Full 6-limb product of two 3-limb operands (row-wise schoolbook).
+GINT_FORCE_INLINE void mul_limbs3_full(uint64_t * GINT_RESTRICT res, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+    using u128 = unsigned __int128;
+    u128 carry = 0;
+    for (size_t j = 0; j < 3; ++j)
+    {
+        carry += u128(lhs[0]) * rhs[j];
+        res[j] = static_cast<uint64_t>(carry);
+        carry >>= 64;
+    }
+    res[3] = static_cast<uint64_t>(carry);
+    for (size_t i = 1; i < 3; ++i)
+    {
+        carry = 0;
+        for (size_t j = 0; j < 3; ++j)
+        {
+            carry += u128(res[i + j]) + u128(lhs[i]) * rhs[j];
+            res[i + j] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+        res[i + 3] = static_cast<uint64_t>(carry);
+    }
+}
+
+// 384-bit: split each operand into 192-bit halves. The low half product is
+// kept in full and the two cross products only contribute their low 192 bits.
+template <>
+GINT_FORCE_INLINE void
+mul_limbs<6>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    uint64_t cross_lo[3];
+    uint64_t cross_hi[3];
+    mul_limbs3_full(res, lhs, rhs);
+    mul_limbs<3>(cross_lo, lhs, rhs + 3);
+    mul_limbs<3>(cross_hi, lhs + 3, rhs);
+    add_limbs_copy_runtime<3>(cross_lo, cross_lo, cross_hi);
+    add_limbs_copy_runtime<3>(res + 3, res + 3, cross_lo);
+}
+
 GINT_FORCE_INLINE void
 mul_limbs4_general(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
 {
@@ -1149,93 +1551,578 @@ template <size_t L>
 GINT_NOINLINE bool
 mul_try_single_limb_operand(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept;
 
-template <size_t L>
-GINT_FORCE_INLINE void
-mul_limbs_schoolbook_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+// Runtime-length kernels for the widths above 1024 bits. Products take the
+// Karatsuba split from 2 * karatsuba_threshold limbs (2048 bits) and halve
+// until an operand is below karatsuba_threshold limbs, where the schoolbook
+// basecase runs; operator* keeps only the low half, fixed multiplication the
+// full product. Division runs a schoolbook loop whose quotient estimates come
+// from one precomputed 3-by-2 reciprocal instead of a hardware divide per limb.
+constexpr size_t karatsuba_threshold = 16;
+constexpr size_t large_kernel_max_limbs = 64;
+
+inline uint64_t add_limbs_n(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs, size_t n) noexcept
 {
-    for (size_t i = 0; i < L; ++i)
-        res[i] = 0;
-    mul_limbs<L>(res, lhs, rhs);
+#    if GINT_DETAIL_X86_64_CARRY_INTRINSICS
+    unsigned char carry = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        unsigned long long r;
+        carry = _addcarry_u64(carry, static_cast<unsigned long long>(lhs[i]), static_cast<unsigned long long>(rhs[i]), &r);
+        dst[i] = static_cast<uint64_t>(r);
+    }
+    return carry;
+#    else
+    unsigned __int128 carry = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        carry += static_cast<unsigned __int128>(lhs[i]) + rhs[i];
+        dst[i] = static_cast<uint64_t>(carry);
+        carry >>= 64;
+    }
+    return static_cast<uint64_t>(carry);
+#    endif
 }
 
-template <size_t L>
-GINT_FORCE_INLINE void
-mul_limbs_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+inline uint64_t sub_limbs_n(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs, size_t n) noexcept
 {
-#    if !GINT_DETAIL_X86_64_GCC
-    if (L > 4 && GINT_UNLIKELY(lhs[L - 1] == 0 || rhs[L - 1] == 0) && mul_try_single_limb_operand<L>(res, lhs, rhs))
-        return;
+#    if GINT_DETAIL_X86_64_CARRY_INTRINSICS
+    unsigned char borrow = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        unsigned long long r;
+        borrow = _subborrow_u64(borrow, static_cast<unsigned long long>(lhs[i]), static_cast<unsigned long long>(rhs[i]), &r);
+        dst[i] = static_cast<uint64_t>(r);
+    }
+    return borrow;
+#    else
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t a = lhs[i];
+        const uint64_t diff = a - rhs[i];
+        dst[i] = diff - borrow;
+        borrow = static_cast<uint64_t>(a < rhs[i]) | static_cast<uint64_t>(diff < borrow);
+    }
+    return borrow;
 #    endif
-    mul_limbs_schoolbook_result<L>(res, lhs, rhs);
 }
 
-template <>
-GINT_FORCE_INLINE void
-mul_limbs_result<2>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+// Propagate a carry into dst[0..n); returns the carry out.
+inline uint64_t increment_limbs_n(uint64_t * dst, size_t n, uint64_t carry) noexcept
 {
-    mul_limbs<2>(res, lhs, rhs);
+    for (size_t i = 0; i < n && carry != 0; ++i)
+    {
+        dst[i] += carry;
+        carry = dst[i] < carry;
+    }
+    return carry;
 }
 
-template <>
-GINT_FORCE_INLINE void
-mul_limbs_result<4>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+inline int compare_limbs_n(const uint64_t * lhs, const uint64_t * rhs, size_t n) noexcept
 {
-    mul_limbs<4>(res, lhs, rhs);
+    for (size_t i = n; i-- > 0;)
+    {
+        if (lhs[i] != rhs[i])
+            return lhs[i] < rhs[i] ? -1 : 1;
+    }
+    return 0;
 }
 
-template <size_t L>
-GINT_FORCE_INLINE bool limbs_zero_above(const uint64_t * data, size_t first) noexcept
+// res[0..n) += a[0..n) * m; returns the carry limb.
+inline uint64_t addmul_limb_n(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT a, size_t n, uint64_t m) noexcept
 {
-    if (data[L - 1] != 0)
-        return false;
-    for (size_t i = first; i < L; ++i)
+    // Two single-limb carry checks keep the 128-bit accumulator out of the
+    // loop-carried chain.
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m;
+        uint64_t low = static_cast<uint64_t>(product);
+        uint64_t high = static_cast<uint64_t>(product >> 64);
+        low += carry;
+        high += low < carry;
+        const uint64_t value = res[i];
+        low += value;
+        high += low < value;
+        res[i] = low;
+        carry = high;
+    }
+    return carry;
+}
+
+// res[0..n) -= a[0..n) * m; returns the borrow limb.
+inline uint64_t submul_limb_n(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT a, size_t n, uint64_t m) noexcept
+{
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; ++i)
     {
-        if (data[i] != 0)
-            return false;
+        const unsigned __int128 product = static_cast<unsigned __int128>(a[i]) * m + borrow;
+        const uint64_t low = static_cast<uint64_t>(product);
+        const uint64_t value = res[i];
+        res[i] = value - low;
+        borrow = static_cast<uint64_t>(product >> 64) + (value < low);
     }
-    return true;
+    return borrow;
 }
 
-template <size_t L>
-GINT_FORCE_INLINE void mul_single_limb_product(uint64_t * res, uint64_t lhs, uint64_t rhs) noexcept
+// res[0..2n) = a[0..n) * b[0..n).
+inline void mul_limbs_full_basecase(uint64_t * GINT_RESTRICT res, const uint64_t * a, const uint64_t * b, size_t n) noexcept
 {
-    const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
-    res[0] = static_cast<uint64_t>(product);
-    if (L > 1)
-        res[1] = static_cast<uint64_t>(product >> 64);
-    for (size_t i = 2; i < L; ++i)
+    for (size_t i = 0; i < n; ++i)
         res[i] = 0;
+    for (size_t i = 0; i < n; ++i)
+        res[i + n] = addmul_limb_n(res + i, a, n, b[i]);
 }
 
-template <size_t L>
-GINT_FORCE_INLINE void mul_limbs_by_limb_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, uint64_t rhs) noexcept
+// |lhs - rhs| into dst; returns whether lhs < rhs.
+inline bool abs_diff_limbs_n(uint64_t * dst, const uint64_t * lhs, const uint64_t * rhs, size_t n) noexcept
 {
-    unsigned __int128 carry = 0;
-    for (size_t i = 0; i < L; ++i)
+    const bool less = compare_limbs_n(lhs, rhs, n) < 0;
+    if (less)
+        sub_limbs_n(dst, rhs, lhs, n);
+    else
+        sub_limbs_n(dst, lhs, rhs, n);
+    return less;
+}
+
+// res[0..2n) = a[0..n) * b[0..n). Karatsuba with the subtractive middle term
+// (a0 - a1)(b1 - b0), so no half-product operand grows by a carry limb.
+inline void mul_limbs_full_n(uint64_t * GINT_RESTRICT res, const uint64_t * a, const uint64_t * b, size_t n) noexcept
+{
+    if (n < karatsuba_threshold || n % 2 != 0 || n > large_kernel_max_limbs)
     {
-        unsigned __int128 cur = static_cast<unsigned __int128>(lhs[i]) * rhs + carry;
-        res[i] = static_cast<uint64_t>(cur);
-        carry = cur >> 64;
+        mul_limbs_full_basecase(res, a, b, n);
+        return;
     }
+    const size_t h = n / 2;
+    uint64_t diff_a[large_kernel_max_limbs / 2];
+    uint64_t diff_b[large_kernel_max_limbs / 2];
+    uint64_t middle[large_kernel_max_limbs];
+    mul_limbs_full_n(res, a, b, h);
+    mul_limbs_full_n(res + n, a + h, b + h, h);
+    const bool a_negative = abs_diff_limbs_n(diff_a, a, a + h, h);
+    const bool b_negative = abs_diff_limbs_n(diff_b, b + h, b, h);
+    mul_limbs_full_n(middle, diff_a, diff_b, h);
+
+    // a0*b1 + a1*b0 = z0 + z2 + (a0 - a1)(b1 - b0) is non-negative, so the
+    // extra high limb stays in [0, 2].
+    uint64_t sum[large_kernel_max_limbs];
+    uint64_t carry = add_limbs_n(sum, res, res + n, n);
+    if (a_negative == b_negative)
+        carry += add_limbs_n(sum, sum, middle, n);
+    else
+        carry -= sub_limbs_n(sum, sum, middle, n);
+    carry += add_limbs_n(res + h, res + h, sum, n);
+    increment_limbs_n(res + h + n, n - h, carry);
 }
 
-template <size_t L>
-GINT_NOINLINE bool
-mul_try_single_limb_operand(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+// res[0..n) = low n limbs of a[0..n) * b[0..n). The low halves multiply in
+// full through mul_limbs_full_n; the cross products a0*b1 and a1*b0 only reach
+// res[h..n), so they recurse into this truncated form.
+inline void mul_limbs_low_n(uint64_t * GINT_RESTRICT res, const uint64_t * a, const uint64_t * b, size_t n) noexcept
 {
-    if (GINT_UNLIKELY((lhs[L - 1] | rhs[L - 1]) == 0))
+    if (n < karatsuba_threshold || n % 2 != 0 || n > large_kernel_max_limbs)
     {
-        uint64_t high_or = 0;
-        for (size_t i = 1; i < L; ++i)
-            high_or |= lhs[i] | rhs[i];
-        if (high_or == 0)
-        {
-            mul_single_limb_product<L>(res, lhs[0], rhs[0]);
-            return true;
-        }
+        for (size_t i = 0; i < n; ++i)
+            res[i] = 0;
+        for (size_t i = 0; i < n; ++i)
+            addmul_limb_n(res + i, a, n - i, b[i]);
+        return;
     }
-    if (limbs_zero_above<L>(rhs, 1))
-    {
+    const size_t h = n / 2;
+    uint64_t cross[large_kernel_max_limbs / 2];
+    mul_limbs_full_n(res, a, b, h);
+    mul_limbs_low_n(cross, a, b + h, h);
+    add_limbs_n(res + h, res + h, cross, h);
+    mul_limbs_low_n(cross, a + h, b, h);
+    add_limbs_n(res + h, res + h, cross, h);
+}
+
+// floor((2^192 - 1) / d) - 2^64 for a normalized two-limb d, computed at run
+// time from the 2-by-1 reciprocal of the top limb (Moller-Granlund alg. 6).
+inline uint64_t reciprocal_3by2_runtime(uint64_t d1, uint64_t d0) noexcept
+{
+    uint64_t v = static_cast<uint64_t>(~static_cast<unsigned __int128>(0) / d1);
+    uint64_t p = d1 * v + d0;
+    if (p < d0)
+    {
+        --v;
+        if (p >= d1)
+        {
+            --v;
+            p -= d1;
+        }
+        p -= d1;
+    }
+    const unsigned __int128 t = static_cast<unsigned __int128>(v) * d0;
+    const uint64_t t1 = static_cast<uint64_t>(t >> 64);
+    p += t1;
+    if (p < t1)
+    {
+        --v;
+        if (p > d1 || (p == d1 && static_cast<uint64_t>(t) >= d0))
+            --v;
+    }
+    return v;
+}
+
+// Schoolbook division of a[0..an) by a normalized d[0..n), n >= 2, with
+// a[an - n..an) < d. Quotient limbs go to q[0..an - n); the remainder is left
+// in a[0..n). Each limb uses one 3-by-2 reciprocal step, so the inner loop
+// only multiplies by a single-limb estimate.
+inline void div_limbs_basecase(uint64_t * GINT_RESTRICT q, uint64_t * a, size_t an, const uint64_t * d, size_t n, uint64_t inv) noexcept
+{
+    const uint64_t d1 = d[n - 1];
+    const uint64_t d0 = d[n - 2];
+    const unsigned __int128 dd = (static_cast<unsigned __int128>(d1) << 64) | d0;
+    uint64_t top = a[an - 1];
+    for (size_t j = an - n; j-- > 0;)
+    {
+        uint64_t * window = a + j;
+        uint64_t qj;
+        if (GINT_UNLIKELY(top == d1 && window[n - 1] == d0))
+        {
+            qj = ~uint64_t(0);
+            submul_limb_n(window, d, n, qj);
+            top = window[n - 1];
+        }
+        else
+        {
+            unsigned __int128 rem;
+            qj = div_3by2_preinv(top, window[n - 1], window[n - 2], dd, inv, rem);
+            const uint64_t borrow = submul_limb_n(window, d, n - 2, qj);
+            uint64_t r0 = static_cast<uint64_t>(rem);
+            uint64_t r1 = static_cast<uint64_t>(rem >> 64);
+            const uint64_t borrow1 = r0 < borrow;
+            r0 -= borrow;
+            const bool negative = r1 < borrow1;
+            r1 -= borrow1;
+            window[n - 2] = r0;
+            top = r1;
+            if (GINT_UNLIKELY(negative))
+            {
+                top += d1 + add_limbs_n(window, window, d, n - 1);
+                --qj;
+            }
+        }
+        q[j] = qj;
+    }
+    a[n - 1] = top;
+}
+
+// Quotient and remainder of u[0..m) by v[0..n), n >= 2, v[n - 1] != 0 and
+// m >= n. q receives m - n + 1 limbs and r receives n limbs.
+template <size_t MaxLimbs>
+GINT_FORCE_INLINE void div_limbs_normalized(
+    uint64_t * q, uint64_t * r, const uint64_t * u, size_t m, const uint64_t * divisor, size_t n, int shift, uint64_t inv) noexcept
+{
+    uint64_t work[MaxLimbs + 1];
+    for (size_t i = 0; i < m; ++i)
+        work[i] = (u[i] << shift) | (shift != 0 && i > 0 ? u[i - 1] >> (64 - shift) : 0);
+    work[m] = shift != 0 ? u[m - 1] >> (64 - shift) : 0;
+
+    div_limbs_basecase(q, work, m + 1, divisor, n, inv);
+    for (size_t i = 0; i < n; ++i)
+        r[i] = (work[i] >> shift) | (shift != 0 && i + 1 < n ? work[i + 1] << (64 - shift) : 0);
+}
+
+template <size_t MaxLimbs>
+GINT_NOINLINE void div_limbs_large(uint64_t * q, uint64_t * r, const uint64_t * u, size_t m, const uint64_t * v, size_t n) noexcept
+{
+    const int shift = __builtin_clzll(v[n - 1]);
+    uint64_t divisor[MaxLimbs];
+    for (size_t i = 0; i < n; ++i)
+        divisor[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+    div_limbs_normalized<MaxLimbs>(q, r, u, m, divisor, n, shift, reciprocal_3by2_runtime(divisor[n - 1], divisor[n - 2]));
+}
+
+#    if GINT_DETAIL_DIVISION_CACHE
+inline division_cache_stats & division_cache_counters() noexcept
+{
+    static thread_local division_cache_stats counters = {0, 0};
+    return counters;
+}
+
+// A divisor magnitude of at least two limbs together with what
+// div_limbs_normalized needs from it. `limbs == 0` marks an empty slot.
+template <size_t MaxLimbs>
+struct division_cache_entry
+{
+    uint64_t divisor[MaxLimbs];
+    uint64_t normalized[MaxLimbs];
+    uint64_t inv;
+    size_t limbs;
+    int shift;
+};
+
+constexpr size_t division_cache_ways = 4;
+
+template <size_t MaxLimbs>
+struct division_cache
+{
+    division_cache_entry<MaxLimbs> entries[division_cache_ways];
+    size_t next;
+};
+
+template <size_t MaxLimbs>
+GINT_NOINLINE const division_cache_entry<MaxLimbs> &
+division_cache_fill(division_cache<MaxLimbs> & cache, const uint64_t * v, size_t n) noexcept
+{
+    division_cache_entry<MaxLimbs> & entry = cache.entries[cache.next];
+    cache.next = (cache.next + 1) % division_cache_ways;
+    const int shift = __builtin_clzll(v[n - 1]);
+    for (size_t i = 0; i < n; ++i)
+    {
+        entry.divisor[i] = v[i];
+        entry.normalized[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+    }
+    entry.inv = reciprocal_3by2_runtime(entry.normalized[n - 1], entry.normalized[n - 2]);
+    entry.limbs = n;
+    entry.shift = shift;
+    ++division_cache_counters().misses;
+    return entry;
+}
+
+// The calling thread's entry for the divisor v[0..n), n >= 2, v[n - 1] != 0.
+// Each limb count has its own small cache, filled round-robin on a miss.
+template <size_t MaxLimbs>
+inline const division_cache_entry<MaxLimbs> & division_cache_lookup(const uint64_t * v, size_t n) noexcept
+{
+    static thread_local division_cache<MaxLimbs> cache;
+    for (size_t way = 0; way < division_cache_ways; ++way)
+    {
+        const division_cache_entry<MaxLimbs> & entry = cache.entries[way];
+        if (entry.limbs != n)
+            continue;
+        size_t i = 0;
+        while (i < n && entry.divisor[i] == v[i])
+            ++i;
+        if (i == n)
+        {
+            ++division_cache_counters().hits;
+            return entry;
+        }
+    }
+    return division_cache_fill(cache, v, n);
+}
+#    endif
+
+template <size_t L>
+GINT_FORCE_INLINE void
+mul_limbs_schoolbook_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    for (size_t i = 0; i < L; ++i)
+        res[i] = 0;
+    mul_limbs<L>(res, lhs, rhs);
+}
+
+template <size_t L>
+GINT_FORCE_INLINE void
+mul_limbs_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+#    if !GINT_DETAIL_X86_64_GCC
+    if (L > 4 && GINT_UNLIKELY(lhs[L - 1] == 0 || rhs[L - 1] == 0) && mul_try_single_limb_operand<L>(res, lhs, rhs))
+        return;
+#    endif
+    if (L >= 2 * karatsuba_threshold)
+    {
+        mul_limbs_low_n(res, lhs, rhs, L);
+        return;
+    }
+    mul_limbs_schoolbook_result<L>(res, lhs, rhs);
+}
+
+template <>
+GINT_FORCE_INLINE void
+mul_limbs_result<2>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    mul_limbs<2>(res, lhs, rhs);
+}
+
+template <>
+GINT_FORCE_INLINE void
+mul_limbs_result<3>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    mul_limbs<3>(res, lhs, rhs);
+}
+
+template <>
+GINT_FORCE_INLINE void
+mul_limbs_result<4>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    mul_limbs<4>(res, lhs, rhs);
+}
+
+template <>
+GINT_FORCE_INLINE void
+mul_limbs_result<6>(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    mul_limbs<6>(res, lhs, rhs);
+}
+
+// Constant-evaluation kernels for *, / and %. The runtime routines rely on
+// intrinsics, inline assembly and uninitialized scratch, none of which may
+// appear in a constant expression, so these are plain limb loops that only
+// run while the compiler evaluates a constant.
+
+// res[0..L) = low L limbs of lhs * rhs.
+template <size_t L>
+GINT_CONSTEXPR14 inline void mul_limbs_constexpr(uint64_t * res, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+    for (size_t i = 0; i < L; ++i)
+        res[i] = 0;
+    for (size_t i = 0; i < L; ++i)
+    {
+        unsigned __int128 carry = 0;
+        for (size_t j = 0; i + j < L; ++j)
+        {
+            const unsigned __int128 t = static_cast<unsigned __int128>(lhs[i]) * rhs[j] + res[i + j] + carry;
+            res[i + j] = static_cast<uint64_t>(t);
+            carry = t >> 64;
+        }
+    }
+}
+
+// Unsigned q = u / v and r = u % v over L limbs, v != 0 (Knuth algorithm D).
+template <size_t L>
+GINT_CONSTEXPR14 inline void divmod_limbs_constexpr(uint64_t * q, uint64_t * r, const uint64_t * u, const uint64_t * v) noexcept
+{
+    using u128 = unsigned __int128;
+    size_t n = L;
+    while (n > 1 && v[n - 1] == 0)
+        --n;
+    size_t m = L;
+    while (m > 0 && u[m - 1] == 0)
+        --m;
+    for (size_t i = 0; i < L; ++i)
+    {
+        q[i] = 0;
+        r[i] = 0;
+    }
+    if (m < n)
+    {
+        for (size_t i = 0; i < m; ++i)
+            r[i] = u[i];
+        return;
+    }
+    if (n == 1)
+    {
+        u128 rem = 0;
+        for (size_t i = m; i-- > 0;)
+        {
+            const u128 cur = (rem << 64) | u[i];
+            q[i] = static_cast<uint64_t>(cur / v[0]);
+            rem = cur % v[0];
+        }
+        r[0] = static_cast<uint64_t>(rem);
+        return;
+    }
+
+    const int shift = __builtin_clzll(v[n - 1]);
+    uint64_t vn[L] = {};
+    uint64_t un[L + 1] = {};
+    for (size_t i = 0; i < n; ++i)
+        vn[i] = (v[i] << shift) | (shift != 0 && i > 0 ? v[i - 1] >> (64 - shift) : 0);
+    for (size_t i = 0; i < m; ++i)
+        un[i] = (u[i] << shift) | (shift != 0 && i > 0 ? u[i - 1] >> (64 - shift) : 0);
+    un[m] = shift != 0 ? u[m - 1] >> (64 - shift) : 0;
+
+    for (size_t j = m - n + 1; j-- > 0;)
+    {
+        const u128 top = (static_cast<u128>(un[j + n]) << 64) | un[j + n - 1];
+        u128 qhat = top / vn[n - 1];
+        u128 rhat = top % vn[n - 1];
+        while ((qhat >> 64) != 0 || qhat * vn[n - 2] > ((rhat << 64) | un[j + n - 2]))
+        {
+            --qhat;
+            rhat += vn[n - 1];
+            if ((rhat >> 64) != 0)
+                break;
+        }
+
+        u128 carry = 0;
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const u128 product = qhat * vn[i] + carry;
+            carry = product >> 64;
+            const u128 diff = static_cast<u128>(un[i + j]) - static_cast<uint64_t>(product) - borrow;
+            un[i + j] = static_cast<uint64_t>(diff);
+            borrow = static_cast<uint64_t>(diff >> 64) != 0;
+        }
+        const u128 diff = static_cast<u128>(un[j + n]) - carry - borrow;
+        un[j + n] = static_cast<uint64_t>(diff);
+        if ((diff >> 64) != 0)
+        {
+            // The estimate was one too large: add the divisor back.
+            --qhat;
+            u128 sum = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                sum = static_cast<u128>(un[i + j]) + vn[i] + (sum >> 64);
+                un[i + j] = static_cast<uint64_t>(sum);
+            }
+            un[j + n] += static_cast<uint64_t>(sum >> 64);
+        }
+        q[j] = static_cast<uint64_t>(qhat);
+    }
+    for (size_t i = 0; i < n; ++i)
+        r[i] = (un[i] >> shift) | (shift != 0 ? un[i + 1] << (64 - shift) : 0);
+}
+
+template <size_t L>
+GINT_FORCE_INLINE bool limbs_zero_above(const uint64_t * data, size_t first) noexcept
+{
+    if (data[L - 1] != 0)
+        return false;
+    for (size_t i = first; i < L; ++i)
+    {
+        if (data[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+template <size_t L>
+GINT_FORCE_INLINE void mul_single_limb_product(uint64_t * res, uint64_t lhs, uint64_t rhs) noexcept
+{
+    const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+    res[0] = static_cast<uint64_t>(product);
+    if (L > 1)
+        res[1] = static_cast<uint64_t>(product >> 64);
+    for (size_t i = 2; i < L; ++i)
+        res[i] = 0;
+}
+
+template <size_t L>
+GINT_FORCE_INLINE void mul_limbs_by_limb_result(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, uint64_t rhs) noexcept
+{
+    unsigned __int128 carry = 0;
+    for (size_t i = 0; i < L; ++i)
+    {
+        unsigned __int128 cur = static_cast<unsigned __int128>(lhs[i]) * rhs + carry;
+        res[i] = static_cast<uint64_t>(cur);
+        carry = cur >> 64;
+    }
+}
+
+template <size_t L>
+GINT_NOINLINE bool
+mul_try_single_limb_operand(uint64_t * GINT_RESTRICT res, const uint64_t * GINT_RESTRICT lhs, const uint64_t * GINT_RESTRICT rhs) noexcept
+{
+    if (GINT_UNLIKELY((lhs[L - 1] | rhs[L - 1]) == 0))
+    {
+        uint64_t high_or = 0;
+        for (size_t i = 1; i < L; ++i)
+            high_or |= lhs[i] | rhs[i];
+        if (high_or == 0)
+        {
+            mul_single_limb_product<L>(res, lhs[0], rhs[0]);
+            return true;
+        }
+    }
+    if (limbs_zero_above<L>(rhs, 1))
+    {
         if (limbs_zero_above<L>(lhs, 1))
             mul_single_limb_product<L>(res, lhs[0], rhs[0]);
         else
@@ -1292,13 +2179,13 @@ template <size_t Bits, typename Signed>
 integer<Bits, Signed> from_string(const std::string & text, unsigned base = 0);
 
 template <size_t Bits, typename Signed>
-integer<Bits, Signed> from_string(const char * text, unsigned base = 0);
+GINT_CONSTEXPR14 integer<Bits, Signed> from_string(const char * text, unsigned base = 0);
 
 template <typename Int>
 Int from_string(const std::string & text, unsigned base = 0);
 
 template <typename Int>
-Int from_string(const char * text, unsigned base = 0);
+GINT_CONSTEXPR14 Int from_string(const char * text, unsigned base = 0);
 
 template <size_t Bits, typename Signed>
 std::ostream & operator<<(std::ostream & out, const integer<Bits, Signed> & value);
@@ -1321,6 +2208,7 @@ public:
     friend class integer;
     friend class std::numeric_limits<integer<Bits, Signed>>;
     friend struct std::hash<integer<Bits, Signed>>;
+    friend struct detail::limb_access;
 #    ifdef GINT_TEST_ACCESS
     friend struct detail::integer_test_access<Bits, Signed>;
 #    endif
@@ -1569,22 +2457,20 @@ public:
         return *this;
     }
 
-    // Note: *= is not marked constexpr due to reliance on non-constexpr helpers
-    integer & operator*=(const integer & rhs) noexcept
+    GINT_CONSTEXPR14 integer & operator*=(const integer & rhs) noexcept
     {
         *this = *this * rhs;
         return *this;
     }
 
-    // Note: /= is not constexpr because of optional zero-checks and complexity
-    GINT_HIDDEN_VISIBILITY integer & operator/=(const integer & rhs)
+    GINT_CONSTEXPR14 GINT_HIDDEN_VISIBILITY integer & operator/=(const integer & rhs)
     {
         *this = *this / rhs;
         return *this;
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    GINT_HIDDEN_VISIBILITY integer & operator/=(T rhs)
+    GINT_CONSTEXPR14 GINT_HIDDEN_VISIBILITY integer & operator/=(T rhs)
     {
         *this = *this / rhs;
         return *this;
@@ -1597,15 +2483,14 @@ public:
         return *this;
     }
 
-    // Note: %= is not constexpr because of optional zero-checks and complexity
-    GINT_HIDDEN_VISIBILITY integer & operator%=(const integer & rhs)
+    GINT_CONSTEXPR14 GINT_HIDDEN_VISIBILITY integer & operator%=(const integer & rhs)
     {
         *this = *this % rhs;
         return *this;
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    GINT_HIDDEN_VISIBILITY integer & operator%=(T rhs)
+    GINT_CONSTEXPR14 GINT_HIDDEN_VISIBILITY integer & operator%=(T rhs)
     {
         *this = *this % rhs;
         return *this;
@@ -2572,37 +3457,39 @@ public:
         return shift_right_integral_value(lhs, n);
     }
 
-    // Multiplication is left non-constexpr due to helper internals
-    friend integer operator*(const integer & lhs, const integer & rhs) noexcept
+    GINT_CONSTEXPR14 friend integer operator*(const integer & lhs, const integer & rhs) noexcept
     {
-        integer result(uninitialized_tag{});
-#    if GINT_DETAIL_X86_64_GCC
-        if (limbs > 4 && GINT_UNLIKELY(lhs.data_[limbs - 1] == 0 || rhs.data_[limbs - 1] == 0)
-            && detail::mul_try_single_limb_operand<limbs>(result.data_, lhs.data_, rhs.data_))
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+        {
+            integer result;
+            detail::mul_limbs_constexpr<limbs>(result.data_, lhs.data_, rhs.data_);
             return result;
+        }
 #    endif
-        // Dispatch to the limb-wise multiplication routine which selects the
-        // appropriate algorithm based on operand size.
-        detail::mul_limbs_result<limbs>(result.data_, lhs.data_, rhs.data_);
-        return result;
+        return mul_runtime(lhs, rhs);
     }
 
-    friend integer operator*(integer lhs, limb_type rhs) noexcept
+    GINT_CONSTEXPR14 friend integer operator*(integer lhs, limb_type rhs) noexcept
     {
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return lhs * integer(rhs);
+#    endif
         detail::mul_limb<limbs>(lhs.data_, rhs);
         return lhs;
     }
 
-    friend integer operator*(limb_type lhs, integer rhs) noexcept { return rhs * lhs; }
+    GINT_CONSTEXPR14 friend integer operator*(limb_type lhs, integer rhs) noexcept { return rhs * lhs; }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend integer operator*(integer lhs, T rhs) noexcept
+    GINT_CONSTEXPR14 friend integer operator*(integer lhs, T rhs) noexcept
     {
         return lhs * integer(rhs);
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend integer operator*(T lhs, integer rhs) noexcept
+    GINT_CONSTEXPR14 friend integer operator*(T lhs, integer rhs) noexcept
     {
         return integer(lhs) * rhs;
     }
@@ -2621,138 +3508,41 @@ public:
         return rhs;
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, const integer & rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, const integer & rhs)
     {
-#    if GINT_GCC_TUNED_PATHS
-        limb_type positive_limb_divisor;
-        if (positive_single_limb_value(rhs, positive_limb_divisor))
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
         {
-            GINT_DIVZERO_CHECK(positive_limb_divisor == 0);
-#        if GINT_DETAIL_AARCH64_GCC
-            if (limbs == 2 && std::is_same<Signed, signed>::value && positive_limb_divisor > 0xFFFFFFFFULL
-                && (positive_limb_divisor & (positive_limb_divisor - 1)) == 0)
-                return div_by_positive_power_of_two(lhs, static_cast<int>(__builtin_ctzll(positive_limb_divisor)));
-#        endif
-            return div_by_positive_limb(lhs, positive_limb_divisor);
+            GINT_DIVZERO_CHECK(rhs.is_zero());
+            return divmod_constexpr(lhs, rhs, false);
         }
-#    elif GINT_DETAIL_AARCH64_CLANG
-        if (limbs == 2)
-        {
-            int positive_pow_bit;
-            if (positive_power_of_two_fastpath_divisor(rhs, positive_pow_bit))
-                return div_by_positive_power_of_two(lhs, positive_pow_bit);
+#    endif
+        return div_runtime(lhs, rhs);
+    }
 
-            limb_type positive_limb_divisor;
-            if (positive_single_limb_value(rhs, positive_limb_divisor))
-            {
-                GINT_DIVZERO_CHECK(positive_limb_divisor == 0);
-                return div_by_positive_limb(lhs, positive_limb_divisor);
-            }
-        }
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, limb_type rhs)
+    {
+        GINT_DIVZERO_CHECK(rhs == 0);
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, false);
 #    endif
+        if (needs_unsigned_signed_promotion(rhs))
+            return div_signed_by_out_of_range_unsigned(lhs, rhs);
+        if (rhs <= static_cast<limb_type>(std::numeric_limits<signed_limb_type>::max()))
+            return lhs / static_cast<signed_limb_type>(rhs);
+        return lhs / integer(rhs);
+    }
 
-        int positive_pow_bit;
-        if (positive_power_of_two_fastpath_divisor(rhs, positive_pow_bit))
-            return div_by_positive_power_of_two(lhs, positive_pow_bit);
-
-        bool lhs_neg = false;
-        bool rhs_neg = false;
-        bool lhs_is_min = false;
-        bool rhs_is_min = false;
-        integer divisor = rhs;
-        if (std::is_same<Signed, signed>::value)
-        {
-            lhs_neg = lhs.data_[limbs - 1] >> 63;
-            rhs_neg = divisor.data_[limbs - 1] >> 63;
-#    if GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG
-            if (lhs_neg && rhs_neg && negative_negative_div_quotient_is_zero(lhs, divisor))
-                return integer();
-#    endif
-            const limb_type min_magnitude = static_cast<limb_type>(1ULL << 63);
-            // Check the full min pattern only after the high limb matches it.
-            if (lhs_neg)
-            {
-                if (GINT_UNLIKELY(lhs.data_[limbs - 1] == min_magnitude && is_min_value(lhs)))
-                    lhs_is_min = true;
-                else
-                    negate_for_division(lhs);
-            }
-            // Apply the same high-limb gate to the divisor.
-            if (rhs_neg)
-            {
-                if (GINT_UNLIKELY(divisor.data_[limbs - 1] == min_magnitude && is_min_value(divisor)))
-                    rhs_is_min = true;
-                else
-                    negate_for_division(divisor);
-            }
-            if (GINT_UNLIKELY(lhs_is_min || rhs_is_min))
-                return div_unsigned_path(lhs, divisor, lhs_neg, rhs_neg, lhs_is_min, rhs_is_min);
-        }
-        integer result;
-        size_t divisor_limbs = limbs;
-        while (divisor_limbs > 0 && divisor.data_[divisor_limbs - 1] == 0)
-            --divisor_limbs;
-        GINT_DIVZERO_CHECK(divisor_limbs == 0);
-        bool small_divisor = divisor_limbs == 1;
-        if (small_divisor)
-        {
-            // single-limb divisor: use fast division/remainder routine
-            lhs.div_mod_small(divisor.data_[0], result);
-        }
-        else
-        {
-            int pow_bit;
-            if (is_power_of_two(divisor, pow_bit))
-            {
-                // power-of-two divisor turns into a simple shift
-                result = lhs >> pow_bit;
-            }
-            else if (limbs == 2)
-            {
-                // both operands are 128-bit wide
-                result = div_128(lhs, divisor);
-            }
-            else if (divisor_limbs == 2)
-            {
-                // Specialized fast path: two-limb divisor
-                result = div_large_2(lhs, divisor);
-            }
-            else if (divisor_limbs == 3)
-            {
-                // Specialized fast path: three-limb divisor
-                result = div_large_3(lhs, divisor);
-            }
-            else if (limbs == 4 && divisor_limbs == 4)
-            {
-                // Specialized fast path: full-width 256-bit divisor produces a single quotient limb.
-                result = div_large_4(lhs, divisor);
-            }
-            else
-            {
-                // Multi-limb divisor: use Knuth's Algorithm D (div_large)
-                result = div_large(lhs, divisor, divisor_limbs);
-            }
-        }
-        if (std::is_same<Signed, signed>::value && lhs_neg != rhs_neg)
-            negate_for_division(result);
-        return result;
-    }
-
-    friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, limb_type rhs)
-    {
-        GINT_DIVZERO_CHECK(rhs == 0);
-        if (needs_unsigned_signed_promotion(rhs))
-            return truncate_promoted_signed(promote_signed_self(lhs) / promote_integral_value(rhs));
-        if (rhs <= static_cast<limb_type>(std::numeric_limits<signed_limb_type>::max()))
-            return lhs / static_cast<signed_limb_type>(rhs);
-        return lhs / integer(rhs);
-    }
-
-    friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, signed_limb_type rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, signed_limb_type rhs)
     {
         GINT_DIVZERO_CHECK(rhs == 0);
         if (GINT_UNLIKELY(rhs == 0))
             return integer();
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, false);
+#    endif
         // For unsigned integers, mimic native casts: reinterpret negative divisors as their two's complement magnitude.
         if (std::is_same<Signed, unsigned>::value && rhs < 0)
             return lhs / integer(rhs);
@@ -2761,105 +3551,52 @@ public:
         return q;
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator/(limb_type lhs, integer rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(limb_type lhs, integer rhs)
     {
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_integral_by_constexpr(lhs, rhs, false);
+#    endif
         if (needs_unsigned_signed_promotion(lhs))
-            return truncate_promoted_signed(promote_integral_value(lhs) / promote_signed_self(rhs));
+            return div_out_of_range_unsigned_by_signed(lhs, rhs);
         return integer(lhs) / rhs;
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, const integer & rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, const integer & rhs)
     {
-        GINT_MODZERO_CHECK(rhs.is_zero());
-#    if GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG
-        if (limbs == 2)
-        {
-            limb_type positive_limb_divisor;
-            if (positive_single_limb_value(rhs, positive_limb_divisor))
-            {
-                integer result;
-                if (std::is_same<Signed, signed>::value && (lhs.data_[1] >> 63))
-                {
-#        if GINT_DETAIL_AARCH64_GCC
-                    return rem_negative_int128_by_positive_limb(lhs, positive_limb_divisor);
-#        else
-                    using Unsigned = integer<Bits, unsigned>;
-                    Unsigned lhs_mag;
-                    copy_abs_magnitude(lhs_mag, lhs, true);
-                    result.data_[0] = lhs_mag.mod_small(positive_limb_divisor);
-                    negate_for_division(result);
-                    return result;
-#        endif
-                }
-
-#        if GINT_DETAIL_AARCH64_GCC
-                using u128 = unsigned __int128;
-                const u128 lhs_raw = (static_cast<u128>(lhs.data_[1]) << 64) | lhs.data_[0];
-                result.data_[0] = static_cast<limb_type>(lhs_raw % positive_limb_divisor);
-#        else
-                result.data_[0] = lhs.mod_small(positive_limb_divisor);
-#        endif
-                return result;
-            }
-        }
-#    endif
-#    if GINT_CLANG_TUNED_PATHS || GINT_ARCH_X86_64
-        if (!(limbs == 2 && (GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG)))
-        {
-            limb_type positive_limb_divisor;
-            if (positive_single_limb_value(rhs, positive_limb_divisor))
-                return rem_by_positive_limb(lhs, positive_limb_divisor);
-        }
-#    endif
-#    if GINT_GCC_TUNED_PATHS
-        if (std::is_same<Signed, signed>::value)
-        {
-            const bool rhs_neg = rhs.data_[limbs - 1] >> 63;
-#        if GINT_DETAIL_X86_64_GCC
-            const bool lhs_neg = lhs.data_[limbs - 1] >> 63;
-            if (!lhs_neg && !rhs_neg)
-                return rem_unsigned_magnitude(lhs, rhs);
-#        endif
-            return rem_signed_magnitude(lhs, rhs, rhs_neg);
-        }
-        else
-        {
-            return rem_unsigned_magnitude(lhs, rhs);
-        }
-#    else
-#        if GINT_CLANG_TUNED_PATHS
-        if (limbs >= 4)
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
         {
-            if (std::is_same<Signed, signed>::value)
-            {
-                const bool rhs_neg = rhs.data_[limbs - 1] >> 63;
-                return rem_signed_magnitude(lhs, rhs, rhs_neg);
-            }
-            return rem_unsigned_magnitude_with_large_direct(lhs, rhs);
+            GINT_MODZERO_CHECK(rhs.is_zero());
+            return divmod_constexpr(lhs, rhs, true);
         }
-#        endif
-        integer q = lhs / rhs;
-        q *= rhs;
-        lhs -= q;
-        return lhs;
 #    endif
+        return mod_runtime(lhs, rhs);
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, limb_type rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, limb_type rhs)
     {
         GINT_MODZERO_CHECK(rhs == 0);
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, true);
+#    endif
         if (needs_unsigned_signed_promotion(rhs))
-            return truncate_promoted_signed(promote_signed_self(lhs) % promote_integral_value(rhs));
+            return rem_signed_by_out_of_range_unsigned(lhs, rhs);
         if (rhs <= static_cast<limb_type>(std::numeric_limits<signed_limb_type>::max()))
             return lhs % static_cast<signed_limb_type>(rhs);
         return lhs % integer(rhs);
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, signed_limb_type rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, signed_limb_type rhs)
     {
         GINT_MODZERO_CHECK(rhs == 0);
         if (GINT_UNLIKELY(rhs == 0))
             return lhs;
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, true);
+#    endif
         // For unsigned integers, mimic native casts: reinterpret negative divisors as their two's complement magnitude.
         if (std::is_same<Signed, unsigned>::value && rhs < 0)
             return lhs % integer(rhs);
@@ -2868,19 +3605,27 @@ public:
         return integer(r);
     }
 
-    friend GINT_HIDDEN_VISIBILITY integer operator%(limb_type lhs, integer rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(limb_type lhs, integer rhs)
     {
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_integral_by_constexpr(lhs, rhs, true);
+#    endif
         if (needs_unsigned_signed_promotion(lhs))
-            return truncate_promoted_signed(promote_integral_value(lhs) % promote_signed_self(rhs));
+            return rem_out_of_range_unsigned_by_signed(lhs, rhs);
         return integer(lhs) % rhs;
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, T rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(integer lhs, T rhs)
     {
         GINT_DIVZERO_CHECK(rhs == 0);
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, false);
+#    endif
         if (needs_unsigned_signed_promotion(rhs))
-            return truncate_promoted_signed(promote_signed_self(lhs) / promote_integral_value(rhs));
+            return div_signed_by_out_of_range_unsigned(lhs, rhs);
         if (sizeof(T) <= sizeof(limb_type)
             && (!detail::is_unsigned<T>::value || rhs <= static_cast<T>(std::numeric_limits<signed_limb_type>::max())))
             return lhs / static_cast<signed_limb_type>(rhs);
@@ -2888,10 +3633,14 @@ public:
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend GINT_HIDDEN_VISIBILITY integer operator/(T lhs, integer rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator/(T lhs, integer rhs)
     {
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_integral_by_constexpr(lhs, rhs, false);
+#    endif
         if (needs_unsigned_signed_promotion(lhs))
-            return truncate_promoted_signed(promote_integral_value(lhs) / promote_signed_self(rhs));
+            return div_out_of_range_unsigned_by_signed(lhs, rhs);
         return integer(lhs) / rhs;
     }
 
@@ -2919,13 +3668,17 @@ public:
     } // LCOV_EXCL_LINE
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, T rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(integer lhs, T rhs)
     {
         GINT_MODZERO_CHECK(rhs == 0);
         if (GINT_UNLIKELY(rhs == 0))
             return lhs;
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_by_integral_constexpr(lhs, rhs, true);
+#    endif
         if (needs_unsigned_signed_promotion(rhs))
-            return truncate_promoted_signed(promote_signed_self(lhs) % promote_integral_value(rhs));
+            return rem_signed_by_out_of_range_unsigned(lhs, rhs);
         // For unsigned integers, mimic native casts: reinterpret negative divisors as their two's complement magnitude.
         if (std::is_same<Signed, unsigned>::value && detail::is_signed<T>::value && rhs < 0)
             return lhs % integer(rhs);
@@ -2940,10 +3693,14 @@ public:
     }
 
     template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
-    friend GINT_HIDDEN_VISIBILITY integer operator%(T lhs, integer rhs)
+    GINT_CONSTEXPR14 friend GINT_HIDDEN_VISIBILITY integer operator%(T lhs, integer rhs)
     {
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+        if (__builtin_is_constant_evaluated())
+            return divmod_integral_by_constexpr(lhs, rhs, true);
+#    endif
         if (needs_unsigned_signed_promotion(lhs))
-            return truncate_promoted_signed(promote_integral_value(lhs) % promote_signed_self(rhs));
+            return rem_out_of_range_unsigned_by_signed(lhs, rhs);
         return integer(lhs) % rhs;
     }
 
@@ -3332,39 +4089,60 @@ private:
     }
 
     template <typename T>
-    void assign_float(T v) noexcept
+    GINT_FORCE_INLINE void assign_float(T v) noexcept
     {
-        for (size_t i = 0; i < limbs; ++i)
-            data_[i] = 0;
-        if (v == 0 || std::isnan(v))
+        using bits_type = typename detail::binary_float_bits<T>::type;
+        assign_float(v, std::integral_constant<bool, !std::is_void<bits_type>::value>());
+    }
+
+    // binary32 and binary64: the integer part is the significand shifted by
+    // the unbiased exponent, which lands in at most two adjacent limbs; the
+    // sign is applied as a branchless conditional negation.
+    template <typename T>
+    GINT_FORCE_INLINE void assign_float(T v, std::true_type) noexcept
+    {
+        using bits_type = typename detail::binary_float_bits<T>::type;
+        constexpr int digits = std::numeric_limits<T>::digits;
+        constexpr int max_exponent = std::numeric_limits<T>::max_exponent;
+        bits_type bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        const bool neg = (bits >> (sizeof(bits_type) * 8 - 1)) != 0;
+        const int biased = static_cast<int>((bits >> (digits - 1)) & (2 * max_exponent - 1));
+        const limb_type fraction = static_cast<limb_type>(bits & ((bits_type(1) << (digits - 1)) - 1));
+        if (biased == 2 * max_exponent - 1)
+        {
+            assign_non_finite(neg, fraction != 0);
             return;
-        if (std::isinf(v))
+        }
+
+        // |v| = significand * 2^shift; zero, subnormals and anything below
+        // one shift out entirely.
+        const limb_type significand = fraction | (limb_type(1) << (digits - 1));
+        const int shift = biased - (max_exponent - 1) - (digits - 1);
+        const limb_type mask = neg ? ~limb_type(0) : limb_type(0);
+        limb_type carry = mask & 1;
+        for (size_t i = 0; i < limbs; ++i)
         {
-            if (v > 0)
-            {
-                if (std::is_same<Signed, unsigned>::value)
-                {
-                    for (size_t i = 0; i < limbs; ++i)
-                        data_[i] = ~limb_type(0);
-                }
-                else
-                {
-                    if (limbs > 1)
-                    {
-                        for (size_t i = 0; i < limbs - 1; ++i)
-                            data_[i] = ~limb_type(0);
-                    }
-                    data_[limbs - 1] = (~limb_type(0)) >> 1;
-                }
-            }
-            else // -inf
-            {
-                if (std::is_same<Signed, signed>::value)
-                    data_[limbs - 1] = limb_type(1) << 63;
-                // Unsigned negative infinity saturates to zero (already zeroed above)
-            }
+            const int offset = shift - 64 * static_cast<int>(i);
+            const limb_type magnitude = offset >= 64 || offset <= -64 ? 0 : offset >= 0 ? significand << offset : significand >> -offset;
+            const limb_type limb = (magnitude ^ mask) + carry;
+            carry = limb < carry;
+            data_[i] = limb;
+        }
+    }
+
+    template <typename T>
+    void assign_float(T v, std::false_type) noexcept
+    {
+        if (std::isnan(v) || std::isinf(v))
+        {
+            assign_non_finite(v < 0, std::isnan(v));
             return;
         }
+        for (size_t i = 0; i < limbs; ++i)
+            data_[i] = 0;
+        if (v == 0)
+            return;
         bool neg = v < 0;
         if (neg)
             v = -v;
@@ -3383,6 +4161,36 @@ private:
             *this = -*this;
     }
 
+    // NaN maps to zero; infinities saturate, with -inf giving zero when unsigned.
+    void assign_non_finite(bool negative, bool nan) noexcept
+    {
+        for (size_t i = 0; i < limbs; ++i)
+            data_[i] = 0;
+        if (nan)
+            return;
+        if (!negative)
+        {
+            if (std::is_same<Signed, unsigned>::value)
+            {
+                for (size_t i = 0; i < limbs; ++i)
+                    data_[i] = ~limb_type(0);
+            }
+            else
+            {
+                if (limbs > 1)
+                {
+                    for (size_t i = 0; i < limbs - 1; ++i)
+                        data_[i] = ~limb_type(0);
+                }
+                data_[limbs - 1] = (~limb_type(0)) >> 1;
+            }
+        }
+        else if (std::is_same<Signed, signed>::value)
+        {
+            data_[limbs - 1] = limb_type(1) << 63;
+        }
+    }
+
     GINT_CONSTEXPR14 bool is_zero() const noexcept
     {
         for (size_t i = 0; i < limbs; ++i)
@@ -3470,24 +4278,81 @@ private:
 
     template <typename Float>
     Float to_binary_float() const noexcept
+    {
+        return to_binary_float<Float>(detail::current_rounding());
+    }
+
+    template <typename Float>
+    Float to_binary_float(rounding mode) const noexcept
     {
         static_assert(std::numeric_limits<Float>::radix == 2, "floating-point conversion requires a binary radix");
         static_assert(std::numeric_limits<Float>::digits < 128, "floating-point conversion supports at most 127 significand bits");
         if (is_zero())
             return Float(0);
+        using bits_type = typename detail::binary_float_bits<Float>::type;
+        return to_binary_float<Float>(mode, std::integral_constant<bool, !std::is_void<bits_type>::value>());
+    }
+
+    // binary32 and binary64: the rounded significand and the exponent are
+    // packed straight into the result's bit pattern.
+    template <typename Float>
+    Float to_binary_float(rounding mode, std::true_type) const noexcept
+    {
+        using bits_type = typename detail::binary_float_bits<Float>::type;
+        constexpr int digits = std::numeric_limits<Float>::digits;
+        constexpr int max_exponent = std::numeric_limits<Float>::max_exponent;
+        constexpr bits_type infinity_bits = static_cast<bits_type>(2 * max_exponent - 1) << (digits - 1);
 
         const bool neg = std::is_same<Signed, signed>::value && (data_[limbs - 1] >> 63);
-        integer mag = neg ? -*this : *this;
-        const int hb = mag.highest_bit();
-        const int digits = std::numeric_limits<Float>::digits;
-        if (hb < digits)
+        const integer mag = neg ? -*this : *this;
+        int exponent = mag.highest_bit();
+        limb_type significand;
+        if (exponent < digits)
         {
-            Float res = 0;
-            for (size_t i = limbs; i-- > 0;)
+            significand = mag.data_[0] << (digits - 1 - exponent);
+        }
+        else
+        {
+            const int shift = exponent - (digits - 1);
+            significand = low_limb_after_logical_right_shift(mag, shift);
+            if (detail::round_magnitude_away(mode, neg, significand & 1, test_bit(mag, shift - 1), has_any_bit_below(mag, shift - 1))
+                && ++significand == limb_type(1) << digits)
             {
-                res = std::ldexp(res, 64);
-                res += static_cast<Float>(mag.data_[i]);
+                significand >>= 1;
+                ++exponent;
             }
+        }
+
+        bits_type bits;
+        if (exponent >= max_exponent)
+        {
+            const bool infinite = mode == rounding::to_nearest || (mode == rounding::upward && !neg) || (mode == rounding::downward && neg);
+            bits = infinite ? infinity_bits : infinity_bits - 1;
+        }
+        else
+        {
+            bits = (static_cast<bits_type>(exponent + max_exponent - 1) << (digits - 1))
+                | static_cast<bits_type>(significand & ((limb_type(1) << (digits - 1)) - 1));
+        }
+        if (neg)
+            bits |= bits_type(1) << (sizeof(bits_type) * 8 - 1);
+        Float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    // Other formats (x87 and binary128 long double) scale the rounded
+    // significand with ldexp; their exponent range cannot overflow here.
+    template <typename Float>
+    Float to_binary_float(rounding mode, std::false_type) const noexcept
+    {
+        const bool neg = std::is_same<Signed, signed>::value && (data_[limbs - 1] >> 63);
+        const integer mag = neg ? -*this : *this;
+        const int hb = mag.highest_bit();
+        const int digits = std::numeric_limits<Float>::digits;
+        if (hb < digits)
+        {
+            const Float res = static_cast<Float>(binary_float_significand<Float>(mag, 0));
             return neg ? -res : res;
         }
 
@@ -3496,27 +4361,7 @@ private:
         significand_type significand = binary_float_significand<Float>(mag, scale);
         const bool guard = test_bit(mag, scale - 1);
         const bool sticky = has_any_bit_below(mag, scale - 1);
-        const bool discarded = guard || sticky;
-        bool increment = false;
-        switch (std::fegetround())
-        {
-            case FE_TONEAREST:
-                increment = guard && (sticky || (significand & 1));
-                break;
-            case FE_UPWARD:
-                increment = !neg && discarded;
-                break;
-            case FE_DOWNWARD:
-                increment = neg && discarded;
-                break;
-            case FE_TOWARDZERO:
-                increment = false;
-                break;
-            default:
-                increment = guard && (sticky || (significand & 1));
-                break;
-        }
-        if (increment)
+        if (detail::round_magnitude_away(mode, neg, significand & 1, guard, sticky))
         {
             ++significand;
             if (significand == (significand_type(1) << digits))
@@ -3526,8 +4371,6 @@ private:
             }
         }
 
-        // Apply the sign before ldexp so directed overflow is rounded in the
-        // direction of the signed result and still raises the usual fenv flags.
         const Float signed_significand = neg ? -static_cast<Float>(significand) : static_cast<Float>(significand);
         return std::ldexp(signed_significand, scale);
     }
@@ -3535,6 +4378,7 @@ private:
     template <size_t L = limbs>
     typename std::enable_if<(L == 1), limb_type>::type div_mod_small(limb_type div, integer & quotient) const noexcept
     {
+        GINT_COUNT_PATH(single_limb);
         // SFINAE provides a dedicated implementation for single-limb integers,
         // avoiding multi-limb code that would trigger -Warray-bounds warnings.
         quotient = integer();
@@ -3547,6 +4391,7 @@ private:
     template <size_t L = limbs>
     typename std::enable_if<(L == 1), limb_type>::type mod_small(limb_type div) const noexcept
     {
+        GINT_COUNT_PATH(single_limb);
         return static_cast<limb_type>(data_[0] % div);
     }
 
@@ -3554,6 +4399,7 @@ private:
     typename std::enable_if<(L > 1), limb_type>::type div_mod_small(limb_type div, integer & quotient) const noexcept
     {
         using u128 = unsigned __int128;
+        GINT_COUNT_PATH(single_limb);
         // This overload is only instantiated for multi-limb integers, preventing
         // compilers from inspecting out-of-bounds accesses in single-limb cases.
         quotient = integer();
@@ -3752,6 +4598,7 @@ private:
     typename std::enable_if<(L > 1), limb_type>::type mod_small(limb_type div) const noexcept
     {
         using u128 = unsigned __int128;
+        GINT_COUNT_PATH(single_limb);
         size_t n = limbs;
         while (n > 0 && data_[n - 1] == 0)
             --n;
@@ -3894,6 +4741,7 @@ private:
             int pow_bit;
             if (Unsigned::is_power_of_two(divisor_mag, pow_bit))
             {
+                GINT_COUNT_PATH(power_of_two);
                 quotient_mag = lhs_mag >> pow_bit;
             }
             else if (limbs == 2)
@@ -3923,6 +4771,270 @@ private:
         return result;
     } // LCOV_EXCL_LINE
 
+    // Runtime bodies of * / %; the operators route constant evaluation to
+    // divmod_constexpr and detail::mul_limbs_constexpr instead. Division
+    // works in place on the operator's by-value dividend.
+    static GINT_FORCE_INLINE integer mul_runtime(const integer & lhs, const integer & rhs) noexcept
+    {
+        integer result(uninitialized_tag{});
+#    if GINT_DETAIL_X86_64_GCC
+        if (limbs > 4 && GINT_UNLIKELY(lhs.data_[limbs - 1] == 0 || rhs.data_[limbs - 1] == 0)
+            && detail::mul_try_single_limb_operand<limbs>(result.data_, lhs.data_, rhs.data_))
+            return result;
+#    endif
+        // Dispatch to the limb-wise multiplication routine which selects the
+        // appropriate algorithm based on operand size.
+        detail::mul_limbs_result<limbs>(result.data_, lhs.data_, rhs.data_);
+        return result;
+    }
+
+    static GINT_FORCE_INLINE integer div_runtime(integer & lhs, const integer & rhs)
+    {
+#    if GINT_GCC_TUNED_PATHS
+        limb_type positive_limb_divisor;
+        if (positive_single_limb_value(rhs, positive_limb_divisor))
+        {
+            GINT_DIVZERO_CHECK(positive_limb_divisor == 0);
+#        if GINT_DETAIL_AARCH64_GCC
+            if (limbs == 2 && std::is_same<Signed, signed>::value && positive_limb_divisor > 0xFFFFFFFFULL
+                && (positive_limb_divisor & (positive_limb_divisor - 1)) == 0)
+                return div_by_positive_power_of_two(lhs, static_cast<int>(__builtin_ctzll(positive_limb_divisor)));
+#        endif
+            return div_by_positive_limb(lhs, positive_limb_divisor);
+        }
+#    elif GINT_DETAIL_AARCH64_CLANG
+        if (limbs == 2)
+        {
+            int positive_pow_bit;
+            if (positive_power_of_two_fastpath_divisor(rhs, positive_pow_bit))
+                return div_by_positive_power_of_two(lhs, positive_pow_bit);
+
+            limb_type positive_limb_divisor;
+            if (positive_single_limb_value(rhs, positive_limb_divisor))
+            {
+                GINT_DIVZERO_CHECK(positive_limb_divisor == 0);
+                return div_by_positive_limb(lhs, positive_limb_divisor);
+            }
+        }
+#    endif
+
+        int positive_pow_bit;
+        if (positive_power_of_two_fastpath_divisor(rhs, positive_pow_bit))
+            return div_by_positive_power_of_two(lhs, positive_pow_bit);
+
+        bool lhs_neg = false;
+        bool rhs_neg = false;
+        bool lhs_is_min = false;
+        bool rhs_is_min = false;
+        integer divisor = rhs;
+        if (std::is_same<Signed, signed>::value)
+        {
+            lhs_neg = lhs.data_[limbs - 1] >> 63;
+            rhs_neg = divisor.data_[limbs - 1] >> 63;
+#    if GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG
+            if (lhs_neg && rhs_neg && negative_negative_div_quotient_is_zero(lhs, divisor))
+                return integer();
+#    endif
+            const limb_type min_magnitude = static_cast<limb_type>(1ULL << 63);
+            // Check the full min pattern only after the high limb matches it.
+            if (lhs_neg)
+            {
+                if (GINT_UNLIKELY(lhs.data_[limbs - 1] == min_magnitude && is_min_value(lhs)))
+                    lhs_is_min = true;
+                else
+                    negate_for_division(lhs);
+            }
+            // Apply the same high-limb gate to the divisor.
+            if (rhs_neg)
+            {
+                if (GINT_UNLIKELY(divisor.data_[limbs - 1] == min_magnitude && is_min_value(divisor)))
+                    rhs_is_min = true;
+                else
+                    negate_for_division(divisor);
+            }
+            if (GINT_UNLIKELY(lhs_is_min || rhs_is_min))
+                return div_unsigned_path(lhs, divisor, lhs_neg, rhs_neg, lhs_is_min, rhs_is_min);
+        }
+        integer result;
+        size_t divisor_limbs = limbs;
+        while (divisor_limbs > 0 && divisor.data_[divisor_limbs - 1] == 0)
+            --divisor_limbs;
+        GINT_DIVZERO_CHECK(divisor_limbs == 0);
+        bool small_divisor = divisor_limbs == 1;
+        if (small_divisor)
+        {
+            // single-limb divisor: use fast division/remainder routine
+            lhs.div_mod_small(divisor.data_[0], result);
+        }
+        else
+        {
+            int pow_bit;
+            if (is_power_of_two(divisor, pow_bit))
+            {
+                // power-of-two divisor turns into a simple shift
+                GINT_COUNT_PATH(power_of_two);
+                result = lhs >> pow_bit;
+            }
+            else if (reciprocal_division(used_limbs(lhs), divisor_limbs, false))
+            {
+                // Quotient of three or more limbs: 3-by-2 reciprocal loop.
+                result = div_or_rem_multi_limb_quotient<false>(lhs, divisor, divisor_limbs);
+            }
+            else if (limbs == 2)
+            {
+                // both operands are 128-bit wide
+                result = div_128(lhs, divisor);
+            }
+            else if (divisor_limbs == 2)
+            {
+                // Specialized fast path: two-limb divisor
+                result = div_large_2(lhs, divisor);
+            }
+            else if (divisor_limbs == 3)
+            {
+                // Specialized fast path: three-limb divisor
+                result = div_large_3(lhs, divisor);
+            }
+            else if (limbs == 4 && divisor_limbs == 4)
+            {
+                // Specialized fast path: full-width 256-bit divisor produces a single quotient limb.
+                result = div_large_4(lhs, divisor);
+            }
+            else
+            {
+                // Multi-limb divisor: use Knuth's Algorithm D (div_large)
+                result = div_large(lhs, divisor, divisor_limbs);
+            }
+        }
+        if (std::is_same<Signed, signed>::value && lhs_neg != rhs_neg)
+            negate_for_division(result);
+        return result;
+    }
+
+    static GINT_FORCE_INLINE integer mod_runtime(integer & lhs, const integer & rhs)
+    {
+        GINT_MODZERO_CHECK(rhs.is_zero());
+#    if GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG
+        if (limbs == 2)
+        {
+            limb_type positive_limb_divisor;
+            if (positive_single_limb_value(rhs, positive_limb_divisor))
+            {
+                integer result;
+                if (std::is_same<Signed, signed>::value && (lhs.data_[1] >> 63))
+                {
+#        if GINT_DETAIL_AARCH64_GCC
+                    return rem_negative_int128_by_positive_limb(lhs, positive_limb_divisor);
+#        else
+                    using Unsigned = integer<Bits, unsigned>;
+                    Unsigned lhs_mag;
+                    copy_abs_magnitude(lhs_mag, lhs, true);
+                    result.data_[0] = lhs_mag.mod_small(positive_limb_divisor);
+                    negate_for_division(result);
+                    return result;
+#        endif
+                }
+
+#        if GINT_DETAIL_AARCH64_GCC
+                using u128 = unsigned __int128;
+                const u128 lhs_raw = (static_cast<u128>(lhs.data_[1]) << 64) | lhs.data_[0];
+                GINT_COUNT_PATH(single_limb);
+                result.data_[0] = static_cast<limb_type>(lhs_raw % positive_limb_divisor);
+#        else
+                result.data_[0] = lhs.mod_small(positive_limb_divisor);
+#        endif
+                return result;
+            }
+        }
+#    endif
+#    if GINT_CLANG_TUNED_PATHS || GINT_ARCH_X86_64
+        if (!(limbs == 2 && (GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG)))
+        {
+            limb_type positive_limb_divisor;
+            if (positive_single_limb_value(rhs, positive_limb_divisor))
+                return rem_by_positive_limb(lhs, positive_limb_divisor);
+        }
+#    endif
+#    if GINT_GCC_TUNED_PATHS
+        if (std::is_same<Signed, signed>::value)
+        {
+            const bool rhs_neg = rhs.data_[limbs - 1] >> 63;
+#        if GINT_DETAIL_X86_64_GCC
+            const bool lhs_neg = lhs.data_[limbs - 1] >> 63;
+            if (!lhs_neg && !rhs_neg)
+                return rem_unsigned_magnitude(lhs, rhs);
+#        endif
+            return rem_signed_magnitude(lhs, rhs, rhs_neg);
+        }
+        else
+        {
+            return rem_unsigned_magnitude(lhs, rhs);
+        }
+#    else
+#        if GINT_CLANG_TUNED_PATHS
+        if (limbs >= 4)
+        {
+            if (std::is_same<Signed, signed>::value)
+            {
+                const bool rhs_neg = rhs.data_[limbs - 1] >> 63;
+                return rem_signed_magnitude(lhs, rhs, rhs_neg);
+            }
+            return rem_unsigned_magnitude_with_large_direct(lhs, rhs);
+        }
+#        endif
+        integer q = lhs / rhs;
+        q *= rhs;
+        lhs -= q;
+        return lhs;
+#    endif
+    }
+
+    // Sign-magnitude division for constant evaluation: the quotient truncates
+    // toward zero and the remainder takes the sign of the dividend. A zero
+    // divisor yields the unchecked results, 0 and the dividend.
+    static GINT_CONSTEXPR14 integer divmod_constexpr(const integer & lhs, const integer & rhs, bool want_remainder) noexcept
+    {
+        if (rhs.is_zero())
+            return want_remainder ? lhs : integer();
+        const bool lhs_neg = std::is_same<Signed, signed>::value && (lhs.data_[limbs - 1] >> 63);
+        const bool rhs_neg = std::is_same<Signed, signed>::value && (rhs.data_[limbs - 1] >> 63);
+        const integer lhs_mag = lhs_neg ? -lhs : lhs;
+        const integer rhs_mag = rhs_neg ? -rhs : rhs;
+        integer quotient;
+        integer remainder;
+        detail::divmod_limbs_constexpr<limbs>(quotient.data_, remainder.data_, lhs_mag.data_, rhs_mag.data_);
+        if (want_remainder)
+            return lhs_neg ? -remainder : remainder;
+        return lhs_neg != rhs_neg ? -quotient : quotient;
+    }
+
+    // Constant-evaluation form of the builtin-operand overloads. Unsigned
+    // operands the signed type cannot represent divide in promoted_signed_type,
+    // matching the runtime out-of-range helpers.
+    template <typename T>
+    static GINT_CONSTEXPR14 integer divmod_by_integral_constexpr(const integer & lhs, T rhs, bool want_remainder)
+    {
+        if (needs_unsigned_signed_promotion(rhs))
+        {
+            const promoted_signed_type wide_lhs = promote_signed_self(lhs);
+            const promoted_signed_type wide_rhs = promote_integral_value(rhs);
+            return integer(want_remainder ? wide_lhs % wide_rhs : wide_lhs / wide_rhs);
+        }
+        return want_remainder ? lhs % integer(rhs) : lhs / integer(rhs);
+    }
+
+    template <typename T>
+    static GINT_CONSTEXPR14 integer divmod_integral_by_constexpr(T lhs, const integer & rhs, bool want_remainder)
+    {
+        if (needs_unsigned_signed_promotion(lhs))
+        {
+            const promoted_signed_type wide_lhs = promote_integral_value(lhs);
+            const promoted_signed_type wide_rhs = promote_signed_self(rhs);
+            return integer(want_remainder ? wide_lhs % wide_rhs : wide_lhs / wide_rhs);
+        }
+        return want_remainder ? integer(lhs) % rhs : integer(lhs) / rhs;
+    }
+
     static size_t used_limbs(const integer & v) noexcept
     {
         size_t n = limbs;
@@ -3951,13 +5063,13 @@ private:
         return high_or == 0;
     }
 
-    static constexpr size_t promoted_signed_bits = Bits < 256 ? 256 : Bits;
+    static constexpr size_t promoted_signed_bits = Bits <= 128 ? 256 : Bits;
     using promoted_signed_type = integer<promoted_signed_bits, signed>;
 
     template <typename T>
     static constexpr bool needs_unsigned_signed_promotion(T value) noexcept
     {
-        return std::is_same<Signed, signed>::value && detail::is_unsigned<T>::value && Bits < 256
+        return std::is_same<Signed, signed>::value && detail::is_unsigned<T>::value && Bits <= 128
             && static_cast<unsigned __int128>(value) >= detail::signed_promotion_limit<Bits>::value();
     }
 
@@ -3976,14 +5088,89 @@ private:
         return promoted_signed_type(value);
     }
 
-    static GINT_CONSTEXPR14 integer truncate_promoted_signed(const promoted_signed_type & value) noexcept
+    // Division between a signed value and an unsigned builtin outside its
+    // range. This only applies when Bits <= 128, so both magnitudes fit in
+    // unsigned __int128 and the division stays in sign-magnitude form instead
+    // of widening both operands to promoted_signed_type.
+    static GINT_FORCE_INLINE unsigned __int128 signed_magnitude_u128(const integer & value, bool neg) noexcept
     {
-        integer result;
-        for (size_t i = 0; i < limbs; ++i)
-            result.data_[i] = value.data_[i];
+        using Unsigned = integer<Bits, unsigned>;
+        Unsigned mag(typename Unsigned::uninitialized_tag{});
+        copy_abs_magnitude(mag, value, neg);
+        return static_cast<unsigned __int128>(mag);
+    }
+
+    // |lhs| <= 2^(Bits-1) <= rhs, so the quotient magnitude is 0 or 1.
+    template <typename T>
+    static integer div_rem_signed_by_out_of_range_unsigned(const integer & lhs, T rhs, bool want_remainder) noexcept
+    {
+        GINT_COUNT_PATH(promoted);
+        using u128 = unsigned __int128;
+        const bool lhs_neg = lhs.data_[limbs - 1] >> 63;
+        const u128 lhs_mag = signed_magnitude_u128(lhs, lhs_neg);
+        const u128 divisor = static_cast<u128>(rhs);
+        const bool quotient_one = lhs_mag >= divisor;
+        integer result(want_remainder ? (quotient_one ? lhs_mag - divisor : lhs_mag) : static_cast<u128>(quotient_one));
+        if (lhs_neg)
+            negate_for_division(result);
+        return result;
+    }
+
+    template <typename T>
+    static integer div_signed_by_out_of_range_unsigned(const integer & lhs, T rhs) noexcept
+    {
+        return div_rem_signed_by_out_of_range_unsigned(lhs, rhs, false);
+    }
+
+    template <typename T>
+    static integer rem_signed_by_out_of_range_unsigned(const integer & lhs, T rhs) noexcept
+    {
+        return div_rem_signed_by_out_of_range_unsigned(lhs, rhs, true);
+    }
+
+    // The remainder takes the sign of the non-negative dividend; only the
+    // quotient picks up the divisor sign.
+    template <typename T>
+    static integer div_rem_out_of_range_unsigned_by_signed(T lhs, const integer & rhs, bool want_remainder) noexcept
+    {
+        GINT_COUNT_PATH(promoted);
+        using u128 = unsigned __int128;
+        if (GINT_UNLIKELY(rhs.is_zero()))
+            return want_remainder ? integer(lhs) : integer();
+        const bool rhs_neg = rhs.data_[limbs - 1] >> 63;
+        const u128 divisor = signed_magnitude_u128(rhs, rhs_neg);
+        const u128 dividend = static_cast<u128>(lhs);
+        u128 value;
+        if ((dividend >> 64) == 0 && (divisor >> 64) == 0)
+        {
+            const uint64_t n = static_cast<uint64_t>(dividend);
+            const uint64_t d = static_cast<uint64_t>(divisor);
+            value = want_remainder ? n % d : n / d;
+        }
+        else
+        {
+            value = want_remainder ? dividend % divisor : dividend / divisor;
+        }
+        integer result(value);
+        if (!want_remainder && rhs_neg)
+            negate_for_division(result);
         return result;
     }
 
+    template <typename T>
+    static integer div_out_of_range_unsigned_by_signed(T lhs, const integer & rhs)
+    {
+        GINT_DIVZERO_CHECK(rhs.is_zero());
+        return div_rem_out_of_range_unsigned_by_signed(lhs, rhs, false);
+    }
+
+    template <typename T>
+    static integer rem_out_of_range_unsigned_by_signed(T lhs, const integer & rhs)
+    {
+        GINT_MODZERO_CHECK(rhs.is_zero());
+        return div_rem_out_of_range_unsigned_by_signed(lhs, rhs, true);
+    }
+
     static GINT_FORCE_INLINE void negate_in_place(integer & v) noexcept
     {
         limb_type carry = 1;
@@ -4034,6 +5221,7 @@ private:
 
     static GINT_FORCE_INLINE integer div_by_positive_power_of_two(integer lhs, int pow_bit) noexcept
     {
+        GINT_COUNT_PATH(power_of_two);
         if (std::is_same<Signed, signed>::value && (lhs.data_[limbs - 1] >> 63))
         {
             const limb_type min_magnitude = static_cast<limb_type>(1ULL << 63);
@@ -4121,6 +5309,7 @@ private:
     template <size_t L = limbs, typename std::enable_if<(L == 2), int>::type = 0>
     static GINT_FORCE_INLINE integer div_unsigned_int128_by_positive_limb(const integer & lhs, limb_type divisor) noexcept
     {
+        GINT_COUNT_PATH(single_limb);
         using u128 = unsigned __int128;
         const u128 lhs_raw = (static_cast<u128>(lhs.data_[1]) << 64) | lhs.data_[0];
         const u128 quotient = lhs_raw / divisor;
@@ -4133,6 +5322,7 @@ private:
     template <size_t L = limbs, typename std::enable_if<(L == 2 && std::is_same<Signed, signed>::value), int>::type = 0>
     static GINT_FORCE_INLINE bool div_signed_int128_by_positive_limb(const integer & lhs, limb_type divisor, integer & result) noexcept
     {
+        GINT_COUNT_PATH(single_limb);
         using u128 = unsigned __int128;
         using s128 = __int128;
         const u128 lhs_raw = (static_cast<u128>(lhs.data_[1]) << 64) | lhs.data_[0];
@@ -4260,19 +5450,29 @@ private:
         int pow_bit;
         if (is_power_of_two(divisor, pow_bit))
         {
+            GINT_COUNT_PATH(power_of_two);
             result = lhs & (divisor - integer(1));
             return result;
         }
 
+        if (reciprocal_division(used_limbs(lhs), divisor_limbs, true))
+            return div_or_rem_multi_limb_quotient<true>(lhs, divisor, divisor_limbs);
 #    if GINT_DETAIL_X86_64_GCC || GINT_DETAIL_AARCH64_CLANG
         if (limbs == 4 && divisor_limbs == 4)
             return rem_large_4(lhs, divisor);
 #    endif
+        // Above 1024 bits the remainder falls out of the division itself;
+        // multiplying the quotient back would cost a full-width product.
+        if (limbs > 16 && divisor_limbs > 3)
+            return div_or_rem_large_core<true>(lhs, divisor, divisor_limbs, used_limbs(lhs));
 
         integer quotient;
         if (limbs == 2)
 #    if GINT_DETAIL_AARCH64_GCC
+        {
+            GINT_COUNT_PATH(int128);
             quotient = div_128_native(lhs, divisor);
+        }
 #    else
             quotient = div_128(lhs, divisor);
 #    endif
@@ -4312,7 +5512,10 @@ private:
             const size_t divisor_limbs = used_limbs(divisor);
             int pow_bit;
             if (is_power_of_two(divisor, pow_bit))
+            {
+                GINT_COUNT_PATH(power_of_two);
                 return lhs & (divisor - integer(1));
+            }
             return rem_large(lhs, divisor, divisor_limbs);
         }
 #    endif
@@ -4379,6 +5582,7 @@ private:
     template <size_t L = limbs>
     static typename std::enable_if<(L >= 2), integer>::type div_128(const integer & lhs, const integer & rhs) noexcept
     {
+        GINT_COUNT_PATH(int128);
 #    if GINT_DETAIL_AARCH64_GCC || GINT_DETAIL_AARCH64_CLANG
         integer result;
         if (GINT_UNLIKELY((rhs.data_[1] | rhs.data_[0]) == 0))
@@ -4472,6 +5676,7 @@ private:
 
     static integer div_large_single_limb_quotient(const integer & lhs, const integer & divisor, size_t div_limbs) noexcept
     {
+        GINT_COUNT_PATH(single_quotient_limb);
         integer quotient;
         if (div_limbs < 2)
             return quotient;
@@ -4503,12 +5708,69 @@ private:
     }
 #    endif
 
+#    if GINT_DETAIL_DIVISION_CACHE
+    // The reciprocal loop of div_or_rem_large_core, but with the normalized
+    // divisor and its 3-by-2 reciprocal taken from the calling thread's
+    // divisor cache. Callers route single-limb and power-of-two divisors
+    // elsewhere and only come here for the shapes reciprocal_division selects.
+    template <bool WantRemainder>
+    static GINT_NOINLINE integer div_or_rem_cached(const integer & lhs, const integer & divisor, size_t v_limbs) noexcept
+    {
+        GINT_COUNT_PATH(cached);
+        const detail::division_cache_entry<limbs> & entry = detail::division_cache_lookup<limbs>(divisor.data_, v_limbs);
+        integer result;
+        limb_type discarded[limbs];
+        detail::div_limbs_normalized<limbs>(
+            WantRemainder ? discarded : result.data_,
+            WantRemainder ? result.data_ : discarded,
+            lhs.data_,
+            used_limbs(lhs),
+            entry.normalized,
+            v_limbs,
+            entry.shift,
+            entry.inv);
+        return result;
+    }
+#    endif
+
+    // Whether dividing u_limbs by v_limbs >= 2 goes through the 3-by-2
+    // reciprocal loop. It beats Knuth D and the two- and three-limb divisor
+    // kernels once the quotient has three limbs. A two-limb quotient is still
+    // faster through those; so is its remainder at 256 bits, where the
+    // quotient is multiplied back by a tuned 4-by-2-limb product, but not
+    // above.
+    static constexpr bool reciprocal_division(size_t u_limbs, size_t v_limbs, bool want_remainder) noexcept
+    {
+        return limbs > 2 && (u_limbs > v_limbs + 1 || (want_remainder && limbs > 4 && u_limbs > v_limbs));
+    }
+
+    // The division reciprocal_division selects. The divisor cache only saves
+    // the normalization and the reciprocal.
+    template <bool WantRemainder>
+    static integer div_or_rem_multi_limb_quotient(const integer & lhs, const integer & divisor, size_t v_limbs) noexcept
+    {
+#    if GINT_DETAIL_DIVISION_CACHE
+        return div_or_rem_cached<WantRemainder>(lhs, divisor, v_limbs);
+#    else
+        return div_or_rem_large_core<WantRemainder>(lhs, divisor, v_limbs, used_limbs(lhs));
+#    endif
+    }
+
     template <bool WantRemainder>
     static GINT_NOINLINE integer div_or_rem_large_core(integer lhs, const integer & divisor, size_t v_limbs, size_t u_limbs) noexcept
     {
         integer result;
         if (GINT_UNLIKELY(v_limbs == 0) || u_limbs < v_limbs)
             return WantRemainder ? lhs : result;
+        if (v_limbs >= 2 && (limbs > 16 || reciprocal_division(u_limbs, v_limbs, WantRemainder)))
+        {
+            GINT_COUNT_PATH(reciprocal);
+            limb_type discarded[limbs];
+            detail::div_limbs_large<limbs>(
+                WantRemainder ? discarded : result.data_, WantRemainder ? result.data_ : discarded, lhs.data_, u_limbs, divisor.data_, v_limbs);
+            return result;
+        }
+        GINT_COUNT_PATH(knuth);
 
         std::array<limb_type, limbs + 1> u;
         std::array<limb_type, limbs + 1> v;
@@ -4685,6 +5947,7 @@ private:
 
     static integer rem_large_single_limb_quotient(integer lhs, const integer & divisor, size_t div_limbs) noexcept
     {
+        GINT_COUNT_PATH(single_quotient_limb);
         if (div_limbs < 2)
             return lhs;
 
@@ -4705,6 +5968,8 @@ private:
     static integer rem_large(integer lhs, const integer & divisor, size_t div_limbs) noexcept
     {
         const size_t dividend_limbs = used_limbs(lhs);
+        if (div_limbs >= 2 && reciprocal_division(dividend_limbs, div_limbs, true))
+            return div_or_rem_multi_limb_quotient<true>(lhs, divisor, div_limbs);
 #    if GINT_DETAIL_AARCH64_GCC
         if (dividend_limbs == div_limbs && div_limbs >= 2)
             return rem_large_single_limb_quotient(lhs, divisor, div_limbs);
@@ -4716,6 +5981,7 @@ private:
     template <size_t L = limbs>
     static GINT_NOINLINE typename std::enable_if<(L == 4), integer>::type div_large_4(integer lhs, const integer & divisor) noexcept
     {
+        GINT_COUNT_PATH(four_limb);
         integer quotient;
         if (lhs.data_[3] == 0)
             return quotient;
@@ -4931,6 +6197,7 @@ private:
     template <size_t L = limbs>
     static typename std::enable_if<(L == 4), integer>::type rem_large_4(integer lhs, const integer & divisor) noexcept
     {
+        GINT_COUNT_PATH(four_limb);
         return rem_large_4_impl(lhs, divisor);
     }
 
@@ -4951,6 +6218,7 @@ private:
     template <size_t L = limbs>
     static typename std::enable_if<(L >= 2), integer>::type div_large_2(integer lhs, const integer & divisor) noexcept GINT_CLANG_NOINLINE
     {
+        GINT_COUNT_PATH(two_limb);
         integer quotient;
         size_t n = limbs;
         while (n > 0 && lhs.data_[n - 1] == 0)
@@ -5138,6 +6406,7 @@ private:
     template <size_t L = limbs>
     static typename std::enable_if<(L >= 3), integer>::type div_large_3(integer lhs, const integer & divisor) noexcept
     {
+        GINT_COUNT_PATH(three_limb);
         integer quotient;
         size_t n = limbs;
         while (n > 0 && lhs.data_[n - 1] == 0)
@@ -5249,7 +6518,8 @@ private:
         return lhs / divisor;
     }
 
-    alignas((GINT_ARCH_AARCH64 || Bits == 64) ? alignof(limb_type) : 16) limb_type data_[limbs];
+    // Odd limb counts keep 8-byte alignment so sizeof stays exactly Bits / 8.
+    alignas((GINT_ARCH_AARCH64 || limbs % 2 != 0) ? alignof(limb_type) : 16) limb_type data_[limbs];
 };
 
 /// Quotient and remainder produced by a single public division operation.
@@ -5266,699 +6536,3049 @@ struct divmod_result
 /// cheaper than evaluating `/` and `%` independently for wide divisors, while
 /// preserving the exact signed and unsigned semantics of those operators.
 template <size_t Bits, typename Signed>
-inline divmod_result<integer<Bits, Signed>> divmod(const integer<Bits, Signed> & dividend, const integer<Bits, Signed> & divisor)
+GINT_CONSTEXPR14 divmod_result<integer<Bits, Signed>> divmod(const integer<Bits, Signed> & dividend, const integer<Bits, Signed> & divisor)
 {
     const integer<Bits, Signed> quotient = dividend / divisor;
     const divmod_result<integer<Bits, Signed>> result = {quotient, dividend - quotient * divisor};
     return result;
 }
 
-#    if __cplusplus < 201703L
-template <size_t Bits, typename Signed>
-constexpr size_t integer<Bits, Signed>::bits;
-
-template <size_t Bits, typename Signed>
-constexpr size_t integer<Bits, Signed>::limbs;
-#    endif
-
-#    ifdef GINT_TEST_ACCESS
 namespace detail
 {
+// Limb storage access for free-function algorithms that live outside the class.
+struct limb_access
+{
+    template <size_t Bits, typename Signed>
+    static GINT_CONSTEXPR14 uint64_t * data(integer<Bits, Signed> & value) noexcept
+    {
+        return value.data_;
+    }
+
+    template <size_t Bits, typename Signed>
+    static constexpr const uint64_t * data(const integer<Bits, Signed> & value) noexcept
+    {
+        return value.data_;
+    }
+
+    template <typename Float, size_t Bits, typename Signed>
+    static Float to_binary_float(const integer<Bits, Signed> & value, rounding mode) noexcept
+    {
+        return value.template to_binary_float<Float>(mode);
+    }
+};
+
 template <size_t Bits, typename Signed>
-struct integer_test_access
+constexpr bool constant_division_negative(const integer<Bits, Signed> & value) noexcept
 {
-    using Int = integer<Bits, Signed>;
-    using limb_type = typename Int::limb_type;
+    return std::is_same<Signed, signed>::value && (limb_access::data(value)[integer<Bits, Signed>::limbs - 1] >> 63) != 0;
+}
 
-    static limb_type & limb(Int & value, size_t index) noexcept { return value.data_[index]; }
+// Magnitude of a signed dividend; the minimum value maps to 2^(Bits-1).
+template <size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, unsigned> constant_division_magnitude(const integer<Bits, Signed> & value, bool negative) noexcept
+{
+    return negative ? -integer<Bits, unsigned>(value) : integer<Bits, unsigned>(value);
+}
 
-    static const limb_type & limb(const Int & value, size_t index) noexcept { return value.data_[index]; }
+template <size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> constant_division_apply_sign(const integer<Bits, unsigned> & magnitude, bool negative) noexcept
+{
+    return negative ? -integer<Bits, Signed>(magnitude) : integer<Bits, Signed>(magnitude);
+}
 
-    static int highest_bit(const Int & value) noexcept { return value.highest_bit(); }
+// Limb i of value << shift, where shift < 64 is a normalization amount.
+template <size_t Bits>
+GINT_CONSTEXPR14 uint64_t constant_division_normalized_limb(const integer<Bits, unsigned> & value, size_t i, unsigned shift) noexcept
+{
+    const uint64_t * u = limb_access::data(value);
+    return shift == 0 ? u[i] : (u[i] << shift) | (i == 0 ? 0 : u[i - 1] >> (64 - shift));
+}
 
-    static bool is_min_value(const Int & value) noexcept { return Int::is_min_value(value); }
+// Divide the low n limbs in place by a single-limb, non-power-of-two constant
+// and return the remainder. Each limb costs one 2-by-1 reciprocal step; a
+// compile-time n lets the loop unroll into straight-line code.
+template <uint64_t Divisor>
+GINT_CONSTEXPR14 uint64_t div_limbs_by_constant_u64(uint64_t * u, size_t n) noexcept
+{
+    using C = constant_divisor_u64<Divisor>;
+    uint64_t rem = C::shift == 0 ? 0 : u[n - 1] >> (64 - C::shift);
+    for (size_t i = n; i-- > 0;)
+    {
+        const uint64_t normalized = C::shift == 0 ? u[i] : (u[i] << C::shift) | (i == 0 ? 0 : u[i - 1] >> (64 - C::shift));
+        u[i] = div_2by1_preinv(rem, normalized, C::normalized, C::reciprocal, rem);
+    }
+    return rem >> C::shift;
+}
 
-    static Int div_unsigned_path(const Int & lhs, const Int & rhs, bool lhs_neg, bool rhs_neg, bool lhs_is_min, bool rhs_is_min)
+// Unsigned division by a single-limb constant.
+template <uint64_t Divisor, size_t Bits>
+GINT_CONSTEXPR14 uint64_t div_by_constant_u64(integer<Bits, unsigned> & quotient, const integer<Bits, unsigned> & value) noexcept
+{
+    using C = constant_divisor_u64<Divisor>;
+    if (C::power_of_two)
     {
-        return Int::div_unsigned_path(lhs, rhs, lhs_neg, rhs_neg, lhs_is_min, rhs_is_min);
+        quotient = value >> static_cast<int>(63 - C::shift);
+        return limb_access::data(value)[0] & (Divisor - 1);
     }
+    quotient = value;
+    return div_limbs_by_constant_u64<Divisor>(limb_access::data(quotient), integer<Bits, unsigned>::limbs);
+}
 
-    static Int div_128(const Int & lhs, const Int & rhs) noexcept { return Int::div_128(lhs, rhs); }
+// Unsigned division by a two-limb constant using 3-by-2 reciprocal steps.
+template <uint64_t High, uint64_t Low, size_t Bits>
+GINT_CONSTEXPR14 unsigned __int128 div_by_constant_u128(integer<Bits, unsigned> & quotient, const integer<Bits, unsigned> & value) noexcept
+{
+    using u128 = unsigned __int128;
+    using C = constant_divisor_u128<High, Low>;
+    const size_t limbs = integer<Bits, unsigned>::limbs;
+    const uint64_t top = C::shift == 0 ? 0 : limb_access::data(value)[limbs - 1] >> (64 - C::shift);
+    u128 rem = (static_cast<u128>(top) << 64) | constant_division_normalized_limb(value, limbs - 1, C::shift);
+    uint64_t * q = limb_access::data(quotient);
+    q[limbs - 1] = 0;
+    for (size_t i = limbs - 1; i-- > 0;)
+        q[i] = div_3by2_preinv(
+            static_cast<uint64_t>(rem >> 64),
+            static_cast<uint64_t>(rem),
+            constant_division_normalized_limb(value, i, C::shift),
+            C::normalized,
+            C::reciprocal,
+            rem);
+    return rem >> C::shift;
+}
+} // namespace detail
 
-    static Int div_large(Int lhs, const Int & rhs, size_t div_limbs) noexcept { return Int::div_large(lhs, rhs, div_limbs); }
+/// Divide by the compile-time constant `Divisor`.
+///
+/// Equivalent to `value / Divisor`, but the reciprocal and normalization are
+/// derived at compile time so each limb costs a multiply-high step instead of
+/// going through the runtime divisor dispatch. Constexpr from C++14.
+template <uint64_t Divisor, size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> div_by(const integer<Bits, Signed> & value) noexcept
+{
+    const bool negative = detail::constant_division_negative(value);
+    integer<Bits, unsigned> quotient;
+    detail::div_by_constant_u64<Divisor>(quotient, detail::constant_division_magnitude(value, negative));
+    return detail::constant_division_apply_sign<Bits, Signed>(quotient, negative);
+}
 
-    static Int rem_large(Int lhs, const Int & rhs, size_t div_limbs) noexcept { return Int::rem_large(lhs, rhs, div_limbs); }
+/// Remainder of division by the compile-time constant `Divisor`; equivalent to `value % Divisor`.
+template <uint64_t Divisor, size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> mod_by(const integer<Bits, Signed> & value) noexcept
+{
+    const bool negative = detail::constant_division_negative(value);
+    integer<Bits, unsigned> quotient;
+    const uint64_t rem = detail::div_by_constant_u64<Divisor>(quotient, detail::constant_division_magnitude(value, negative));
+    return detail::constant_division_apply_sign<Bits, Signed>(integer<Bits, unsigned>(rem), negative);
+}
 
-    static Int div_large_2(Int lhs, const Int & rhs) noexcept { return Int::div_large_2(lhs, rhs); }
+/// Divide by the 128-bit compile-time constant `High * 2^64 + Low`.
+///
+/// `High` must be non-zero; single-limb constants use the one-argument form.
+template <uint64_t High, uint64_t Low, size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> div_by(const integer<Bits, Signed> & value) noexcept
+{
+    const bool negative = detail::constant_division_negative(value);
+    integer<Bits, unsigned> quotient;
+    detail::div_by_constant_u128<High, Low>(quotient, detail::constant_division_magnitude(value, negative));
+    return detail::constant_division_apply_sign<Bits, Signed>(quotient, negative);
+}
 
-    static Int div_large_3(Int lhs, const Int & rhs) noexcept { return Int::div_large_3(lhs, rhs); }
+/// Remainder of division by the 128-bit compile-time constant `High * 2^64 + Low`.
+template <uint64_t High, uint64_t Low, size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> mod_by(const integer<Bits, Signed> & value) noexcept
+{
+    const bool negative = detail::constant_division_negative(value);
+    integer<Bits, unsigned> quotient;
+    const unsigned __int128 rem = detail::div_by_constant_u128<High, Low>(quotient, detail::constant_division_magnitude(value, negative));
+    return detail::constant_division_apply_sign<Bits, Signed>(integer<Bits, unsigned>(rem), negative);
+}
 
-    static Int div_large_4(Int lhs, const Int & rhs) noexcept { return Int::div_large_4(lhs, rhs); }
+/// `value` rounded to `Float` with the compile-time rounding `Mode` instead
+/// of the `fegetround()` mode used by the conversion operators. `float` and
+/// `double` results are assembled directly from the bits and raise no
+/// floating-point exceptions.
+template <typename Float, rounding Mode = rounding::to_nearest, size_t Bits, typename Signed>
+inline Float to_binary_float(const integer<Bits, Signed> & value) noexcept
+{
+    return detail::limb_access::to_binary_float<Float>(value, Mode);
+}
 
-    template <typename T>
-    static int compare_with_float_abs(const Int & lhs_abs, T rhs_abs) noexcept
-    {
-        return Int::template compare_with_float_abs<T>(lhs_abs, rhs_abs);
-    }
-};
-} // namespace detail
+/// `out[i] = integer<Bits, Signed>(values[i])` for i in [0, count): truncation
+/// toward zero, high bits wrapping, NaN to zero and infinities saturating.
+template <size_t Bits, typename Signed>
+inline void from_double(const double * values, size_t count, integer<Bits, Signed> * out) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = integer<Bits, Signed>(values[i]);
+}
+
+/// `out[i] = to_binary_float<double, Mode>(values[i])` for i in [0, count).
+template <rounding Mode = rounding::to_nearest, size_t Bits, typename Signed>
+inline void to_double(const integer<Bits, Signed> * values, size_t count, double * out) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = to_binary_float<double, Mode>(values[i]);
+}
+
+/// Hits and misses of the calling thread's divisor cache since the thread
+/// started or since the last reset. Always zero unless the translation unit
+/// defines `GINT_ENABLE_DIVISION_CACHE`.
+inline division_cache_stats division_cache_statistics() noexcept
+{
+#    if GINT_DETAIL_DIVISION_CACHE
+    return detail::division_cache_counters();
+#    else
+    return division_cache_stats{0, 0};
 #    endif
+}
 
-} // namespace GINT_DETAIL_CONFIG_NAMESPACE
-} // namespace gint
+/// Zero the calling thread's divisor cache counters. The cached divisors stay.
+inline void reset_division_cache_statistics() noexcept
+{
+#    if GINT_DETAIL_DIVISION_CACHE
+    detail::division_cache_counters() = division_cache_stats{0, 0};
+#    endif
+}
 
-#    if defined(__clang__)
-#        pragma clang diagnostic push
-#        pragma clang diagnostic ignored "-Wdeprecated-declarations"
-#    elif defined(__GNUC__)
-#        pragma GCC diagnostic push
-#        pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+namespace stats
+{
+/// The calling thread's dispatch counters since the thread started or since
+/// the last reset. Always zero unless the translation unit defines
+/// `GINT_ENABLE_PATH_STATS`.
+inline counters snapshot() noexcept
+{
+#    if GINT_DETAIL_PATH_STATS
+    return detail::path_stats_counters();
+#    else
+    return counters{};
 #    endif
+}
 
-namespace std
+/// Zero the calling thread's dispatch counters.
+inline void reset() noexcept
 {
-template <size_t Bits, typename Signed>
-class numeric_limits<gint::integer<Bits, Signed>>
+#    if GINT_DETAIL_PATH_STATS
+    detail::path_stats_counters() = counters{};
+#    endif
+}
+} // namespace stats
+
+//=== Bit manipulation =======================================================
+// Counterparts of C++20 <bit> for unsigned wide integers. Every limb is
+// visited with a fixed trip count and selected without data-dependent
+// branches, so fixed widths unroll into straight-line code.
+
+/// Number of consecutive zero bits starting from the most significant bit.
+template <size_t Bits>
+GINT_CONSTEXPR14 int countl_zero(const integer<Bits, unsigned> & value) noexcept
 {
-public:
-    static constexpr bool is_specialized = true;
-    static constexpr bool is_signed = std::is_same<Signed, signed>::value;
-    static constexpr bool is_integer = true;
-    static constexpr bool is_exact = true;
-    static constexpr bool has_infinity = false;
-    static constexpr bool has_quiet_NaN = false;
-    static constexpr bool has_signaling_NaN = false;
-    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
-    static constexpr bool has_denorm_loss = false;
-    static constexpr std::float_round_style round_style = std::round_toward_zero;
-    static constexpr bool is_iec559 = false;
-    static constexpr bool is_bounded = true;
-    static constexpr bool is_modulo = true;
-    static constexpr int digits = static_cast<int>(Bits) - (is_signed ? 1 : 0);
-    static constexpr int digits10 = digits * 30103 / 100000;
-    static constexpr int max_digits10 = 0;
-    static constexpr int radix = 2;
-    static constexpr int min_exponent = 0;
-    static constexpr int min_exponent10 = 0;
-    static constexpr int max_exponent = 0;
-    static constexpr int max_exponent10 = 0;
-    static constexpr bool traps = false;
-    static constexpr bool tinyness_before = false;
+    const uint64_t * limbs = detail::limb_access::data(value);
+    int result = static_cast<int>(Bits);
+    for (size_t i = 0; i < integer<Bits, unsigned>::limbs; ++i)
+    {
+        const int candidate = static_cast<int>(Bits - 64 * (i + 1)) + __builtin_clzll(limbs[i] | 1);
+        result = limbs[i] != 0 ? candidate : result;
+    }
+    return result;
+}
 
-    static constexpr gint::integer<Bits, Signed> min() noexcept { return gint::integer<Bits, Signed>::numeric_min(); }
+/// Number of consecutive zero bits starting from the least significant bit.
+template <size_t Bits>
+GINT_CONSTEXPR14 int countr_zero(const integer<Bits, unsigned> & value) noexcept
+{
+    const uint64_t * limbs = detail::limb_access::data(value);
+    int result = static_cast<int>(Bits);
+    for (size_t i = integer<Bits, unsigned>::limbs; i-- > 0;)
+    {
+        const int candidate = static_cast<int>(64 * i) + __builtin_ctzll(limbs[i] | (uint64_t(1) << 63));
+        result = limbs[i] != 0 ? candidate : result;
+    }
+    return result;
+}
 
-    static constexpr gint::integer<Bits, Signed> max() noexcept { return gint::integer<Bits, Signed>::numeric_max(); }
+/// Number of consecutive one bits starting from the most significant bit.
+template <size_t Bits>
+GINT_CONSTEXPR14 int countl_one(const integer<Bits, unsigned> & value) noexcept
+{
+    return countl_zero(~value);
+}
 
-    static constexpr gint::integer<Bits, Signed> lowest() noexcept { return min(); }
-    static constexpr gint::integer<Bits, Signed> epsilon() noexcept { return gint::integer<Bits, Signed>(0); }
-    static constexpr gint::integer<Bits, Signed> round_error() noexcept { return gint::integer<Bits, Signed>(0); }
-    static constexpr gint::integer<Bits, Signed> infinity() noexcept { return gint::integer<Bits, Signed>(0); }
-    static constexpr gint::integer<Bits, Signed> quiet_NaN() noexcept { return gint::integer<Bits, Signed>(0); }
-    static constexpr gint::integer<Bits, Signed> signaling_NaN() noexcept { return gint::integer<Bits, Signed>(0); }
-    static constexpr gint::integer<Bits, Signed> denorm_min() noexcept { return gint::integer<Bits, Signed>(0); }
-};
+/// Number of consecutive one bits starting from the least significant bit.
+template <size_t Bits>
+GINT_CONSTEXPR14 int countr_one(const integer<Bits, unsigned> & value) noexcept
+{
+    return countr_zero(~value);
+}
 
+/// Number of one bits.
+template <size_t Bits>
+GINT_CONSTEXPR14 int popcount(const integer<Bits, unsigned> & value) noexcept
+{
+    const uint64_t * limbs = detail::limb_access::data(value);
+    int result = 0;
+    for (size_t i = 0; i < integer<Bits, unsigned>::limbs; ++i)
+        result += detail::popcount64(limbs[i]);
+    return result;
+}
+
+/// True when exactly one bit is set.
+template <size_t Bits>
+GINT_CONSTEXPR14 bool has_single_bit(const integer<Bits, unsigned> & value) noexcept
+{
+    return popcount(value) == 1;
+}
+
+/// Number of bits needed to represent the value; zero for zero.
+template <size_t Bits>
+GINT_CONSTEXPR14 int bit_width(const integer<Bits, unsigned> & value) noexcept
+{
+    return static_cast<int>(Bits) - countl_zero(value);
+}
+
+namespace detail
+{
+// Rotate left by a count already reduced to [0, Bits). Each output limb
+// combines two source limbs; the split shift avoids a 64-bit shift when the
+// bit offset is zero.
+template <size_t Bits>
+GINT_CONSTEXPR14 integer<Bits, unsigned> rotate_left_reduced(const integer<Bits, unsigned> & value, size_t count) noexcept
+{
+    const size_t limbs = integer<Bits, unsigned>::limbs;
+    const size_t limb_shift = count / 64;
+    const unsigned bit_shift = static_cast<unsigned>(count % 64);
+    const uint64_t * src = limb_access::data(value);
+    integer<Bits, unsigned> result;
+    uint64_t * dst = limb_access::data(result);
+    for (size_t i = 0; i < limbs; ++i)
+    {
+        const uint64_t high = src[(i + limbs - limb_shift) % limbs];
+        const uint64_t low = src[(i + 2 * limbs - limb_shift - 1) % limbs];
+        dst[i] = (high << bit_shift) | ((low >> 1) >> (63 - bit_shift));
+    }
+    return result;
+}
+
+template <size_t Bits>
+constexpr size_t rotate_count_left(int count) noexcept
+{
+    return count >= 0 ? static_cast<size_t>(count) % Bits : (Bits - static_cast<size_t>(-(static_cast<long long>(count))) % Bits) % Bits;
+}
+} // namespace detail
+
+/// Rotate left by `count` bits; negative counts rotate right.
+template <size_t Bits>
+GINT_CONSTEXPR14 integer<Bits, unsigned> rotl(const integer<Bits, unsigned> & value, int count) noexcept
+{
+    return detail::rotate_left_reduced(value, detail::rotate_count_left<Bits>(count));
+}
+
+/// Rotate right by `count` bits; negative counts rotate left.
+template <size_t Bits>
+GINT_CONSTEXPR14 integer<Bits, unsigned> rotr(const integer<Bits, unsigned> & value, int count) noexcept
+{
+    return detail::rotate_left_reduced(value, (Bits - detail::rotate_count_left<Bits>(count)) % Bits);
+}
+
+/// Reverse the byte order of the full `Bits / 8` byte representation.
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_specialized;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_signed;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_integer;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_exact;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_infinity;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_quiet_NaN;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_signaling_NaN;
-template <size_t Bits, typename Signed>
-constexpr std::float_denorm_style numeric_limits<gint::integer<Bits, Signed>>::has_denorm;
-template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_denorm_loss;
+GINT_CONSTEXPR14 integer<Bits, Signed> byteswap(const integer<Bits, Signed> & value) noexcept
+{
+    const size_t limbs = integer<Bits, Signed>::limbs;
+    const uint64_t * src = detail::limb_access::data(value);
+    integer<Bits, Signed> result;
+    uint64_t * dst = detail::limb_access::data(result);
+    for (size_t i = 0; i < limbs; ++i)
+        dst[i] = __builtin_bswap64(src[limbs - 1 - i]);
+    return result;
+}
+
+//=== Integer logarithms =====================================================
+
+namespace detail
+{
+// Number of decimal digits of an unsigned value, one for zero. The bit width
+// gives an estimate that is exact or one too high; a single borrow-chain
+// compare against the matching power of ten settles it. Setting the low bit
+// maps zero to one and never crosses a power of ten, since those are even.
+template <size_t Bits>
+GINT_CONSTEXPR14 GINT_FORCE_INLINE int decimal_digits_unsigned(const integer<Bits, unsigned> & value) noexcept
+{
+    using table = pow10_table<Bits>;
+    const int width = bit_width(value);
+    const size_t estimate = decimal_exponent_estimate(static_cast<size_t>(width + (width == 0)));
+    const uint64_t * u = limb_access::data(value);
+    const uint64_t * p = table::rows::value[estimate / table::stride].limb;
+    uint64_t scaled[table::limbs] = {};
+    if (table::stride != 1)
+    {
+        const uint64_t m = pow10_u64(estimate % table::stride);
+        unsigned __int128 carry = 0;
+        for (size_t i = 0; i < table::limbs; ++i)
+        {
+            carry += static_cast<unsigned __int128>(p[i]) * m;
+            scaled[i] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+        p = scaled;
+    }
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < table::limbs; ++i)
+    {
+        const uint64_t limb = u[i] | (i == 0);
+        const uint64_t diff = limb - p[i];
+        borrow = static_cast<uint64_t>(limb < p[i]) | static_cast<uint64_t>(diff < borrow);
+    }
+    return static_cast<int>(estimate) + 1 - static_cast<int>(borrow);
+}
+} // namespace detail
+
+/// Number of decimal digits in the magnitude of `value`, excluding any sign; one for zero.
 template <size_t Bits, typename Signed>
-constexpr std::float_round_style numeric_limits<gint::integer<Bits, Signed>>::round_style;
+GINT_CONSTEXPR14 GINT_FORCE_INLINE int decimal_digits(const integer<Bits, Signed> & value) noexcept
+{
+    return detail::decimal_digits_unsigned(detail::constant_division_magnitude(value, detail::constant_division_negative(value)));
+}
+
+/// floor(log2(value)) for positive values; -1 when `value <= 0`.
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_iec559;
+GINT_CONSTEXPR14 int ilog2(const integer<Bits, Signed> & value) noexcept
+{
+    return detail::constant_division_negative(value) ? -1 : bit_width(integer<Bits, unsigned>(value)) - 1;
+}
+
+/// floor(log10(value)) for positive values; -1 when `value <= 0`.
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_bounded;
+GINT_CONSTEXPR14 int ilog10(const integer<Bits, Signed> & value) noexcept
+{
+    return ilog2(value) < 0 ? -1 : detail::decimal_digits_unsigned(integer<Bits, unsigned>(value)) - 1;
+}
+
+//=== Reductions and scans ==================================================
+
+namespace detail
+{
+// Fold per-limb partial sums into `out`. low[i] is the wrapped sum of limb i
+// over all values and carries[i] counts its wraps, which belong one limb up.
+// Signed values were summed as unsigned limbs, 2^Bits too high for each
+// negative one; subtracting `negatives` from the extra top limb corrects that.
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_modulo;
+inline void add_limb_sums(integer<Bits + 64, Signed> & out, const uint64_t * low, const uint64_t * carries, uint64_t negatives) noexcept
+{
+    constexpr size_t limbs = Bits / 64;
+    integer<Bits + 64, unsigned> sum;
+    integer<Bits + 64, unsigned> carried;
+    uint64_t * s = limb_access::data(sum);
+    uint64_t * c = limb_access::data(carried);
+    for (size_t i = 0; i < limbs; ++i)
+    {
+        s[i] = low[i];
+        c[i + 1] = carries[i];
+    }
+    s[limbs] = 0 - negatives;
+    sum += carried;
+    out += integer<Bits + 64, Signed>(sum);
+}
+
+// Track the extreme by address so the update is one conditional move rather
+// than a branch or a per-limb select. The compare stops at the first
+// differing limb, which random and sorted inputs predict well.
+template <bool Maximum, size_t Bits, typename Signed>
+inline void reduce_extreme(const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> & out) noexcept
+{
+    const integer<Bits, Signed> * best = &out;
+    for (size_t row = 0; row < count; ++row)
+    {
+        const integer<Bits, Signed> * candidate = values + row;
+        const bool take = Maximum ? *best < *candidate : *candidate < *best;
+        best = take ? candidate : best;
+    }
+    out = *best;
+}
+} // namespace detail
+
+/// Running sum of `integer<Bits, Signed>` values in carry-save form.
+///
+/// Each limb keeps its own wrapped sum and a count of its wraps, so `+=` has
+/// no carry chain from limb to limb and successive adds overlap; the carries
+/// are propagated only by `value()`, which returns the exact sum widened by
+/// one limb. Accumulators filled separately, e.g. one per thread, combine
+/// with `+=`. Exact for fewer than 2^64 added values.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::digits;
+class accumulator
+{
+public:
+    using value_type = integer<Bits, Signed>;
+    using result_type = integer<Bits + 64, Signed>;
+    static constexpr size_t limbs = value_type::limbs;
+
+    accumulator() noexcept : low_(), carries_(), negatives_(0) { }
+
+    GINT_FORCE_INLINE accumulator & operator+=(const value_type & value) noexcept
+    {
+        const uint64_t * source = detail::limb_access::data(value);
+        for (size_t i = 0; i < limbs; ++i)
+        {
+            low_[i] += source[i];
+            carries_[i] += static_cast<uint64_t>(low_[i] < source[i]);
+        }
+        if (std::is_same<Signed, signed>::value)
+            negatives_ += source[limbs - 1] >> 63;
+        return *this;
+    }
+
+    /// Merge the values added to `other`.
+    accumulator & operator+=(const accumulator & other) noexcept
+    {
+        for (size_t i = 0; i < limbs; ++i)
+        {
+            low_[i] += other.low_[i];
+            carries_[i] += other.carries_[i] + static_cast<uint64_t>(low_[i] < other.low_[i]);
+        }
+        negatives_ += other.negatives_;
+        return *this;
+    }
+
+    result_type value() const noexcept
+    {
+        result_type sum = 0;
+        detail::add_limb_sums<Bits>(sum, low_, carries_, negatives_);
+        return sum;
+    }
+
+    void clear() noexcept { *this = accumulator(); }
+
+private:
+    uint64_t low_[limbs];
+    uint64_t carries_[limbs];
+    uint64_t negatives_;
+};
+
+#    if __cplusplus < 201703L
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::digits10;
+constexpr size_t accumulator<Bits, Signed>::limbs;
+#    endif
+
+/// Add the sum of `values[0, count)` to `out`.
+///
+/// The range is summed in an `accumulator`, so the loop carries no
+/// dependency from limb to limb. The 64 extra bits of `out` absorb any
+/// overflow of `Bits`: one call is exact for any `count`, and overflow shows
+/// as a result outside the range of `integer<Bits, Signed>`.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_digits10;
+inline void reduce_sum(const integer<Bits, Signed> * values, size_t count, integer<Bits + 64, Signed> & out) noexcept
+{
+    accumulator<Bits, Signed> sum;
+    for (size_t row = 0; row < count; ++row)
+        sum += values[row];
+    out += sum.value();
+}
+
+/// Lower `out` to the least of its value and `values[0, count)`; start it at
+/// the first element or at `std::numeric_limits<...>::max()`. A new minimum
+/// is taken with a conditional move, not a branch.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::radix;
+inline void reduce_min(const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> & out) noexcept
+{
+    detail::reduce_extreme<false>(values, count, out);
+}
+
+/// Raise `out` to the greatest of its value and `values[0, count)`.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::min_exponent;
+inline void reduce_max(const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> & out) noexcept
+{
+    detail::reduce_extreme<true>(values, count, out);
+}
+
+/// Mean of `values[0, count)` as the quotient and remainder of their exact
+/// sum divided by `count`, with the semantics of `divmod`. A zero `count`
+/// divides by zero.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::min_exponent10;
+inline divmod_result<integer<Bits, Signed>> reduce_avg(const integer<Bits, Signed> * values, size_t count)
+{
+    integer<Bits + 64, Signed> sum = 0;
+    reduce_sum(values, count, sum);
+    const divmod_result<integer<Bits + 64, Signed>> wide = divmod(sum, integer<Bits + 64, Signed>(count));
+    const divmod_result<integer<Bits, Signed>> result = {integer<Bits, Signed>(wide.quotient), integer<Bits, Signed>(wide.remainder)};
+    return result;
+}
+
+namespace detail
+{
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_exponent;
+GINT_FORCE_INLINE integer<Bits, Signed> scan_add(const integer<Bits, Signed> & lhs, const integer<Bits, Signed> & rhs) noexcept
+{
+    return lhs + rhs;
+}
+
+#    if GINT_DETAIL_X86_64_CARRY_INTRINSICS
+// The 128-bit pair form operator+ uses at 256 bits on GCC leaves the running
+// sum of a scan going through the stack; an explicit adc chain keeps it in
+// registers. Other widths scan faster through operator+.
+template <typename Signed>
+GINT_FORCE_INLINE integer<256, Signed> scan_add(const integer<256, Signed> & lhs, const integer<256, Signed> & rhs) noexcept
+{
+    integer<256, Signed> result;
+    const uint64_t * a = limb_access::data(lhs);
+    const uint64_t * b = limb_access::data(rhs);
+    uint64_t * r = limb_access::data(result);
+    unsigned char carry = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        unsigned long long limb;
+        carry = _addcarry_u64(carry, static_cast<unsigned long long>(a[i]), static_cast<unsigned long long>(b[i]), &limb);
+        r[i] = static_cast<uint64_t>(limb);
+    }
+    return result;
+}
+#    endif
+
+// Each row is read before its output is written, so `out` may equal `values`.
+// The loops follow std::partial_sum's shape, which GCC keeps in registers at
+// every width; indexed forms of the same loop spill at 128 and 512 bits.
 template <size_t Bits, typename Signed>
-constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_exponent10;
+inline void inclusive_scan_rows(
+    const integer<Bits, Signed> * first, size_t count, integer<Bits, Signed> * out, const integer<Bits, Signed> & init) noexcept
+{
+    if (count == 0)
+        return;
+    const integer<Bits, Signed> * last = first + count;
+    integer<Bits, Signed> sum = scan_add(init, *first);
+    *out = sum;
+    while (++first != last)
+    {
+        sum = scan_add(sum, *first);
+        *++out = sum;
+    }
+}
+
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::traps;
+inline void exclusive_scan_rows(
+    const integer<Bits, Signed> * first, size_t count, integer<Bits, Signed> * out, const integer<Bits, Signed> & init) noexcept
+{
+    const integer<Bits, Signed> * last = first + count;
+    integer<Bits, Signed> sum = init;
+    for (; first != last; ++first, ++out)
+    {
+        const integer<Bits, Signed> next = *first;
+        *out = sum;
+        sum = scan_add(sum, next);
+    }
+}
+} // namespace detail
+
+/// `out[i] = init + values[0] + ... + values[i]` for i in [0, count),
+/// wrapping like `+`. `out` may equal `values`.
 template <size_t Bits, typename Signed>
-constexpr bool numeric_limits<gint::integer<Bits, Signed>>::tinyness_before;
+inline void inclusive_scan(
+    const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> * out, const integer<Bits, Signed> & init = 0) noexcept
+{
+    detail::inclusive_scan_rows(values, count, out, init);
+}
 
+/// `out[i] = init + values[0] + ... + values[i - 1]` for i in [0, count),
+/// wrapping like `+`. `out` may equal `values`.
 template <size_t Bits, typename Signed>
-struct hash<gint::integer<Bits, Signed>>
+inline void exclusive_scan(
+    const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> * out, const integer<Bits, Signed> & init = 0) noexcept
 {
-    size_t operator()(const gint::integer<Bits, Signed> & value) const noexcept
+    detail::exclusive_scan_rows(values, count, out, init);
+}
+
+//=== Fixed point ============================================================
+
+namespace detail
+{
+// Full 2L-limb product; fixed-point multiplication keeps the middle L limbs
+// instead of the low half retained by mul_limbs. Schoolbook, except that wide
+// runtime products go through the Karatsuba kernel.
+template <size_t L>
+GINT_CONSTEXPR14 inline void mul_limbs_full(uint64_t * res, const uint64_t * lhs, const uint64_t * rhs) noexcept
+{
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+    if (L >= 2 * karatsuba_threshold && !__builtin_is_constant_evaluated())
     {
-        using Int = gint::integer<Bits, Signed>;
-        size_t seed = 0;
-        for (size_t i = 0; i < Int::limbs; ++i)
+        mul_limbs_full_n(res, lhs, rhs, L);
+        return;
+    }
+#    elif __cplusplus < 201402L
+    if (L >= 2 * karatsuba_threshold)
+    {
+        mul_limbs_full_n(res, lhs, rhs, L);
+        return;
+    }
+#    endif
+    for (size_t i = 0; i < 2 * L; ++i)
+        res[i] = 0;
+    for (size_t i = 0; i < L; ++i)
+    {
+        unsigned __int128 carry = 0;
+        for (size_t j = 0; j < L; ++j)
         {
-            const size_t h = std::hash<typename Int::limb_type>()(value.data_[i]);
-            seed ^= h + static_cast<size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+            const unsigned __int128 cur
+                = static_cast<unsigned __int128>(res[i + j]) + static_cast<unsigned __int128>(lhs[i]) * rhs[j] + carry;
+            res[i + j] = static_cast<uint64_t>(cur);
+            carry = cur >> 64;
         }
-        return seed;
+        res[i + L] = static_cast<uint64_t>(carry);
     }
-};
-} // namespace std
+}
 
-#    if defined(__clang__)
-#        pragma clang diagnostic pop
-#    elif defined(__GNUC__)
-#        pragma GCC diagnostic pop
-#    endif
+} // namespace detail
 
-#endif // GINT_DETAIL_CORE_DEFINITIONS_INCLUDED
+/// Binary fixed-point number with `FracBits` fraction bits stored in an
+/// `integer<Bits, Signed>` (Q(Bits - FracBits).FracBits).
+///
+/// Addition, subtraction and comparison act on the raw value. Multiplication
+/// forms the full double-width product before shifting, and division shifts
+/// the dividend into a double-width Knuth division, so neither loses
+/// intermediate bits. Results wrap modulo `2^Bits` like `integer`, and the
+/// operators truncate toward zero; `mul` and `div` take an explicit rounding.
+template <size_t Bits, size_t FracBits, typename Signed = signed>
+class fixed
+{
+    static_assert(FracBits < Bits, "fixed needs at least one integer bit");
+    static_assert(Bits <= 2048, "fixed uses a double-width intermediate; Bits must be at most 2048");
 
-#if !defined(GINT_DETAIL_CORE_ONLY) && !defined(GINT_DETAIL_IO_DEFINITIONS_INCLUDED)
-#    define GINT_DETAIL_IO_DEFINITIONS_INCLUDED
+public:
+    using raw_type = integer<Bits, Signed>;
+    static constexpr size_t bits = Bits;
+    static constexpr size_t frac_bits = FracBits;
 
-// A translation unit may include <gint/core.h> first and upgrade to the
-// umbrella header later. The core pass cleans up its implementation macros, so
-// recreate the small subset needed by the string/stream/fmt extension pass.
-#    ifndef GINT_DETAIL_HEADER_PASS_ACTIVE
-#        define GINT_DETAIL_HEADER_PASS_ACTIVE
-#        if defined(__GNUC__) || defined(__clang__)
-#            define GINT_FORCE_INLINE inline __attribute__((always_inline))
-#            define GINT_NOINLINE __attribute__((noinline))
-#        else
-#            define GINT_FORCE_INLINE inline
-#            define GINT_NOINLINE
-#        endif
-#        if defined(__x86_64__) && GINT_GCC_TUNED_PATHS
-#            define GINT_WIDE_PARSE_INLINE inline GINT_NOINLINE
-#        else
-#            define GINT_WIDE_PARSE_INLINE GINT_FORCE_INLINE
-#        endif
-#        if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
-#            define GINT_DETAIL_EXCEPTIONS_ENABLED 1
-#            define GINT_THROW(exception) throw exception
-#        else
-#            define GINT_DETAIL_EXCEPTIONS_ENABLED 0
-#            define GINT_THROW(exception) ::std::abort()
-#        endif
-#        if defined(GINT_ENABLE_DIVZERO_CHECKS)
-#            define GINT_DETAIL_DIVZERO_CHECKS 1
-#        else
-#            define GINT_DETAIL_DIVZERO_CHECKS 0
-#        endif
-#        if GINT_GCC_TUNED_PATHS
-#            define GINT_DETAIL_GCC_TUNED_POLICY 1
-#        else
-#            define GINT_DETAIL_GCC_TUNED_POLICY 0
-#        endif
-#        if GINT_CLANG_TUNED_PATHS
-#            define GINT_DETAIL_CLANG_TUNED_POLICY 1
-#        else
-#            define GINT_DETAIL_CLANG_TUNED_POLICY 0
-#        endif
-#        if GINT_ENABLE_AARCH64_LIMB_ASM
-#            define GINT_DETAIL_AARCH64_ASM_POLICY 1
-#        else
-#            define GINT_DETAIL_AARCH64_ASM_POLICY 0
-#        endif
-#        define GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
-            config_d##divzero##_g##gcc_tuned##_c##clang_tuned##_a##aarch64_asm##_e##exceptions
-#        define GINT_DETAIL_CONFIG_NAMESPACE_II(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
-            GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, gcc_tuned, clang_tuned, aarch64_asm, exceptions)
-#        define GINT_DETAIL_CONFIG_NAMESPACE \
-            GINT_DETAIL_CONFIG_NAMESPACE_II( \
-                GINT_DETAIL_DIVZERO_CHECKS, \
-                GINT_DETAIL_GCC_TUNED_POLICY, \
-                GINT_DETAIL_CLANG_TUNED_POLICY, \
-                GINT_DETAIL_AARCH64_ASM_POLICY, \
-                GINT_DETAIL_EXCEPTIONS_ENABLED)
+    constexpr fixed() noexcept = default;
+
+    /// Exact conversion from a built-in integer; high bits wrap.
+    template <typename T, typename std::enable_if<detail::is_integral<T>::value, int>::type = 0>
+    GINT_CONSTEXPR14 fixed(T value) noexcept
+        : raw_(raw_type(value) << static_cast<int>(FracBits))
+    {
+    }
+
+    /// Conversion from a floating-point value, truncated toward zero.
+    template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    explicit fixed(T value) noexcept
+        : raw_(from_float<rounding::toward_zero>(value).raw_)
+    {
+    }
+
+    /// Reinterpret `raw` as a value scaled by `2^FracBits`.
+    static constexpr fixed from_raw(const raw_type & raw) noexcept { return fixed(raw, raw_tag()); }
+
+    /// Convert a floating-point value with an explicit rounding mode. NaN maps
+    /// to zero and infinities saturate, as for `integer`.
+    template <rounding Mode, typename T>
+    static fixed from_float(T value) noexcept
+    {
+        static_assert(std::is_floating_point<T>::value, "from_float requires a floating-point argument");
+        const T scaled = std::ldexp(value, static_cast<int>(FracBits));
+        const T whole = std::trunc(scaled);
+        raw_type raw(whole);
+        if (!std::isfinite(scaled) || scaled == whole)
+            return from_raw(raw);
+        const T fraction = std::fabs(scaled - whole);
+        const bool negative = scaled < 0;
+        const bool odd = std::fmod(whole, T(2)) != 0;
+        if (detail::round_magnitude_away(Mode, negative, odd, fraction >= T(0.5), fraction != T(0.5)))
+            raw = negative ? raw - raw_type(1) : raw + raw_type(1);
+        return from_raw(raw);
+    }
+
+    constexpr const raw_type & raw() const noexcept { return raw_; }
+
+    /// Nearest `T` to the exact value, honoring the current floating-point
+    /// rounding mode. Results below the smallest normal `T` may round twice.
+    template <typename T>
+    T to_float() const noexcept
+    {
+        static_assert(std::is_floating_point<T>::value, "to_float requires a floating-point type");
+        return std::ldexp(static_cast<T>(raw_), -static_cast<int>(FracBits));
+    }
+
+    explicit operator double() const noexcept { return to_float<double>(); }
+
+    explicit operator float() const noexcept { return to_float<float>(); }
+
+    explicit operator long double() const noexcept { return to_float<long double>(); }
+
+    GINT_CONSTEXPR14 fixed operator-() const noexcept { return from_raw(-raw_); }
+
+    GINT_CONSTEXPR14 fixed & operator+=(const fixed & rhs) noexcept
+    {
+        raw_ += rhs.raw_;
+        return *this;
+    }
+
+    GINT_CONSTEXPR14 fixed & operator-=(const fixed & rhs) noexcept
+    {
+        raw_ -= rhs.raw_;
+        return *this;
+    }
+
+    GINT_CONSTEXPR14 fixed & operator*=(const fixed & rhs) noexcept
+    {
+        *this = multiply<rounding::toward_zero>(*this, rhs);
+        return *this;
+    }
+
+    fixed & operator/=(const fixed & rhs)
+    {
+        *this = divide<rounding::toward_zero>(*this, rhs);
+        return *this;
+    }
+
+    GINT_CONSTEXPR14 friend fixed operator+(fixed lhs, const fixed & rhs) noexcept { return lhs += rhs; }
+
+    GINT_CONSTEXPR14 friend fixed operator-(fixed lhs, const fixed & rhs) noexcept { return lhs -= rhs; }
+
+    GINT_CONSTEXPR14 friend fixed operator*(const fixed & lhs, const fixed & rhs) noexcept
+    {
+        return multiply<rounding::toward_zero>(lhs, rhs);
+    }
+
+    friend fixed operator/(const fixed & lhs, const fixed & rhs) { return divide<rounding::toward_zero>(lhs, rhs); }
+
+    friend constexpr bool operator==(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ == rhs.raw_; }
+
+    friend constexpr bool operator!=(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ != rhs.raw_; }
+
+    friend constexpr bool operator<(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ < rhs.raw_; }
+
+    friend constexpr bool operator>(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ > rhs.raw_; }
+
+    friend constexpr bool operator<=(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ <= rhs.raw_; }
+
+    friend constexpr bool operator>=(const fixed & lhs, const fixed & rhs) noexcept { return lhs.raw_ >= rhs.raw_; }
+
+    /// Product rounded with `Mode`.
+    template <rounding Mode>
+    static GINT_CONSTEXPR14 fixed multiply(const fixed & lhs, const fixed & rhs) noexcept
+    {
+        using magnitude_type = integer<Bits, unsigned>;
+        const size_t limbs = raw_type::limbs;
+        const size_t limb_shift = FracBits / 64;
+        const unsigned bit_shift = static_cast<unsigned>(FracBits % 64);
+        const bool lhs_negative = detail::constant_division_negative(lhs.raw_);
+        const bool rhs_negative = detail::constant_division_negative(rhs.raw_);
+        const magnitude_type a = detail::constant_division_magnitude(lhs.raw_, lhs_negative);
+        const magnitude_type b = detail::constant_division_magnitude(rhs.raw_, rhs_negative);
+
+        uint64_t product[2 * limbs] = {};
+        detail::mul_limbs_full<limbs>(product, detail::limb_access::data(a), detail::limb_access::data(b));
+
+        magnitude_type result;
+        uint64_t * r = detail::limb_access::data(result);
+        for (size_t i = 0; i < limbs; ++i)
+        {
+            const uint64_t low = product[i + limb_shift];
+            const uint64_t high = product[i + limb_shift + 1 < 2 * limbs ? i + limb_shift + 1 : 2 * limbs - 1];
+            r[i] = bit_shift == 0 ? low : (low >> bit_shift) | (high << (64 - bit_shift));
+        }
+
+        bool guard = false;
+        bool sticky = false;
+        if (FracBits != 0)
+        {
+            const size_t guard_limb = (FracBits - 1) / 64;
+            const unsigned guard_bit = static_cast<unsigned>((FracBits - 1) % 64);
+            guard = ((product[guard_limb] >> guard_bit) & 1) != 0;
+            uint64_t below = product[guard_limb] & ((uint64_t(1) << guard_bit) - 1);
+            for (size_t i = 0; i < guard_limb; ++i)
+                below |= product[i];
+            sticky = below != 0;
+        }
+        const bool negative = lhs_negative != rhs_negative;
+        if (detail::round_magnitude_away(Mode, negative, (r[0] & 1) != 0, guard, sticky))
+            ++result;
+        return from_raw(detail::constant_division_apply_sign<Bits, Signed>(result, negative));
+    }
+
+    /// Quotient rounded with `Mode`. A zero divisor behaves like `integer` division.
+    template <rounding Mode>
+    static fixed divide(const fixed & lhs, const fixed & rhs)
+    {
+        using magnitude_type = integer<Bits, unsigned>;
+        using wide_type = integer<2 * Bits, unsigned>;
+        const bool lhs_negative = detail::constant_division_negative(lhs.raw_);
+        const bool rhs_negative = detail::constant_division_negative(rhs.raw_);
+        const magnitude_type a = detail::constant_division_magnitude(lhs.raw_, lhs_negative);
+        const magnitude_type b = detail::constant_division_magnitude(rhs.raw_, rhs_negative);
+        const wide_type quotient = (wide_type(a) << static_cast<int>(FracBits)) / wide_type(b);
+        magnitude_type result(quotient);
+        const bool negative = lhs_negative != rhs_negative;
+        if (Mode != rounding::toward_zero)
+        {
+            // The remainder is below the divisor, so Bits-wide wrapping
+            // arithmetic recovers it exactly without a double-width multiply.
+            const magnitude_type remainder = (a << static_cast<int>(FracBits)) - magnitude_type(quotient) * b;
+            const magnitude_type rest = b - remainder;
+            const bool guard = remainder >= rest;
+            const bool sticky = remainder != magnitude_type(0) && remainder != rest;
+            if (detail::round_magnitude_away(Mode, negative, (detail::limb_access::data(result)[0] & 1) != 0, guard, sticky))
+                ++result;
+        }
+        return from_raw(detail::constant_division_apply_sign<Bits, Signed>(result, negative));
+    }
+
+private:
+    struct raw_tag
+    {
+    };
+
+    constexpr fixed(const raw_type & raw, raw_tag) noexcept
+        : raw_(raw)
+    {
+    }
+
+    raw_type raw_;
+};
+
+/// `lhs * rhs` rounded with `Mode`.
+template <rounding Mode, size_t Bits, size_t FracBits, typename Signed>
+GINT_CONSTEXPR14 fixed<Bits, FracBits, Signed>
+mul(const fixed<Bits, FracBits, Signed> & lhs, const fixed<Bits, FracBits, Signed> & rhs) noexcept
+{
+    return fixed<Bits, FracBits, Signed>::template multiply<Mode>(lhs, rhs);
+}
+
+/// `lhs / rhs` rounded with `Mode`.
+template <rounding Mode, size_t Bits, size_t FracBits, typename Signed>
+inline fixed<Bits, FracBits, Signed> div(const fixed<Bits, FracBits, Signed> & lhs, const fixed<Bits, FracBits, Signed> & rhs)
+{
+    return fixed<Bits, FracBits, Signed>::template divide<Mode>(lhs, rhs);
+}
+
+//=== Random numbers =========================================================
+
+namespace detail
+{
+constexpr unsigned urbg_bits(uint64_t max) noexcept
+{
+    return max == 0 ? 0 : 1 + urbg_bits(max >> 1);
+}
+
+// One uniformly random limb from as many URBG calls as it takes.
+template <typename URBG>
+inline uint64_t random_limb(URBG & urbg)
+{
+    constexpr uint64_t max = static_cast<uint64_t>(URBG::max());
+    static_assert(URBG::min() == 0 && (max & (max + 1)) == 0, "the generator must produce every value of [0, 2^w) for some w");
+    constexpr unsigned width = urbg_bits(max);
+    uint64_t limb = static_cast<uint64_t>(urbg());
+    for (unsigned shift = width; shift < 64; shift += width)
+        limb |= static_cast<uint64_t>(urbg()) << shift;
+    return limb;
+}
+
+// product[0, d + k) = x[0, d) * b[0, k).
+GINT_FORCE_INLINE void
+mul_uniform_draw(uint64_t * GINT_RESTRICT product, const uint64_t * x, const uint64_t * b, size_t d, size_t k) noexcept
+{
+    for (size_t i = 0; i < d; ++i)
+        product[i] = 0;
+    for (size_t i = 0; i < k; ++i)
+        product[i + d] = addmul_limb_n(product + i, x, d, b[i]);
+}
+
+// Whether the low half `low`, already below `bound`, is at least
+// 2^(64d) mod bound: 2^(64k) mod bound, doubled once per extra bit of d.
+template <size_t Bits>
+GINT_NOINLINE GINT_COLD bool uniform_low_accepted(const uint64_t * low, const integer<Bits, unsigned> & bound, size_t d, size_t k)
+{
+    using unsigned_type = integer<Bits, unsigned>;
+    const unsigned_type wrap = k == unsigned_type::limbs ? unsigned_type(0) : unsigned_type(1) << static_cast<int>(64 * k);
+    unsigned_type threshold = (wrap - bound) % bound;
+    for (size_t i = 0; i < 64 * (d - k); ++i)
+    {
+        const bool carry = (threshold >> static_cast<int>(Bits - 1)) != 0;
+        threshold <<= 1;
+        if (carry || threshold >= bound)
+            threshold -= bound;
+    }
+    return compare_limbs_n(low, limb_access::data(threshold), k) >= 0;
+}
+} // namespace detail
+
+/// Uniformly random `integer<Bits, unsigned>`, one limb at a time from `urbg`.
+/// The generator's range must be `[0, 2^w)`, as for `std::mt19937` (two calls
+/// per limb) and `std::mt19937_64` (one call).
+template <size_t Bits, typename URBG>
+inline integer<Bits, unsigned> random_bits(URBG & urbg)
+{
+    integer<Bits, unsigned> value = 0;
+    uint64_t * limbs = detail::limb_access::data(value);
+    for (size_t i = 0; i < integer<Bits, unsigned>::limbs; ++i)
+        limbs[i] = detail::random_limb(urbg);
+    return value;
+}
+
+/// Uniformly random value in `[0, n)`; `n` must be positive, and zero divides
+/// by zero.
+///
+/// Lemire's nearly-divisionless method on whole limbs: the result is the high
+/// half of a random d-limb value times the k-limb `n`, and the draw is retried
+/// only when the low half falls below `2^(64d) mod n`. That remainder is
+/// needed only when the low half is below `n`. d is k, or k + 1 when the top
+/// limb of `n` is large enough that the low half would often be below `n`;
+/// either way a draw divides or retries with probability under 2^-16.
+template <typename URBG, size_t Bits, typename Signed>
+inline integer<Bits, Signed> uniform_below(URBG & urbg, const integer<Bits, Signed> & n)
+{
+    using unsigned_type = integer<Bits, unsigned>;
+    constexpr size_t limbs = unsigned_type::limbs;
+    const unsigned_type bound(n);
+    if (bound == 0)
+        return integer<Bits, Signed>(bound % bound);
+    const uint64_t * b = detail::limb_access::data(bound);
+    size_t k = limbs;
+    while (b[k - 1] == 0)
+        --k;
+    const size_t d = (b[k - 1] >> 48) != 0 ? k + 1 : k;
+    uint64_t x[limbs + 1];
+    uint64_t product[2 * limbs + 1];
+    for (;;)
+    {
+        for (size_t i = 0; i < d; ++i)
+            x[i] = detail::random_limb(urbg);
+        // The full-width bound gets constant trip counts.
+        if (d == limbs + 1)
+            detail::mul_uniform_draw(product, x, b, limbs + 1, limbs);
+        else
+            detail::mul_uniform_draw(product, x, b, d, k);
+        if ((d != k && product[k] != 0) || detail::compare_limbs_n(product, b, k) >= 0)
+            break;
+        if (detail::uniform_low_accepted(product, bound, d, k))
+            break;
+    }
+    unsigned_type result = 0;
+    uint64_t * r = detail::limb_access::data(result);
+    for (size_t i = 0; i < k; ++i)
+        r[i] = product[d + i];
+    return integer<Bits, Signed>(result);
+}
+
+//=== Literals ===============================================================
+// Literal operator templates receive the characters of the literal, so the
+// value is parsed while compiling and an unusable literal is a compile error.
+// They need C++14 loops in constexpr functions.
+
+#    if __cplusplus >= 201402L
+namespace detail
+{
+enum class literal_status
+{
+    ok,
+    invalid_digit,
+    out_of_range
+};
+
+template <size_t L>
+struct literal_limbs
+{
+    uint64_t limb[L];
+    literal_status status;
+};
+
+// Digits of an integer literal: 0x / 0b prefixes, a leading 0 for octal and
+// ' separators, as the core language accepts them. Signed types keep the sign
+// bit clear; the most negative value is spelled -max - 1.
+template <size_t L, char... Chars>
+constexpr literal_limbs<L> parse_literal(bool is_signed) noexcept
+{
+    const char text[] = {Chars...};
+    const size_t size = sizeof...(Chars);
+    literal_limbs<L> result{{}, literal_status::ok};
+    size_t pos = 0;
+    unsigned base = 10;
+    if (size >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+    {
+        base = 16;
+        pos = 2;
+    }
+    else if (size >= 2 && text[0] == '0' && (text[1] == 'b' || text[1] == 'B'))
+    {
+        base = 2;
+        pos = 2;
+    }
+    else if (size >= 2 && text[0] == '0')
+    {
+        base = 8;
+        pos = 1;
+    }
+    for (; pos < size; ++pos)
+    {
+        const char c = text[pos];
+        if (c == '\'')
+            continue;
+        const unsigned digit = c >= '0' && c <= '9' ? static_cast<unsigned>(c - '0')
+            : c >= 'a' && c <= 'f'                  ? static_cast<unsigned>(c - 'a' + 10)
+            : c >= 'A' && c <= 'F'                  ? static_cast<unsigned>(c - 'A' + 10)
+                                                    : 16u;
+        if (digit >= base)
+        {
+            result.status = literal_status::invalid_digit;
+            return result;
+        }
+        unsigned __int128 carry = digit;
+        for (size_t i = 0; i < L; ++i)
+        {
+            const unsigned __int128 t = static_cast<unsigned __int128>(result.limb[i]) * base + carry;
+            result.limb[i] = static_cast<uint64_t>(t);
+            carry = t >> 64;
+        }
+        if (carry != 0)
+        {
+            result.status = literal_status::out_of_range;
+            return result;
+        }
+    }
+    if (is_signed && (result.limb[L - 1] >> 63) != 0)
+        result.status = literal_status::out_of_range;
+    return result;
+}
+
+template <typename Int, size_t L>
+constexpr Int literal_from_limbs(const literal_limbs<L> & parsed) noexcept
+{
+    Int value;
+    uint64_t * limbs = limb_access::data(value);
+    for (size_t i = 0; i < L; ++i)
+        limbs[i] = parsed.limb[i];
+    return value;
+}
+
+// The parsed value as a static constant, so every use reads a constant and
+// the literal's diagnostics fire once per distinct literal.
+template <typename Int, char... Chars>
+struct literal
+{
+    static constexpr literal_limbs<Int::limbs> parsed
+        = parse_literal<Int::limbs, Chars...>(std::is_same<typename Int::signed_tag, signed>::value);
+    static_assert(parsed.status != literal_status::invalid_digit, "gint literal contains a character that is not a digit of its base");
+    static_assert(parsed.status != literal_status::out_of_range, "gint literal does not fit in the literal's type");
+    static constexpr Int value = literal_from_limbs<Int>(parsed);
+};
+
+#        if __cplusplus < 201703L
+template <typename Int, char... Chars>
+constexpr literal_limbs<Int::limbs> literal<Int, Chars...>::parsed;
+
+template <typename Int, char... Chars>
+constexpr Int literal<Int, Chars...>::value;
+#        endif
+} // namespace detail
+
+inline namespace literals
+{
+/// `340282366920938463463374607431768211455_u128`, `0xff_i256`, ...: integer
+/// literals parsed at compile time. Decimal, hexadecimal, binary and octal
+/// spellings and digit separators are accepted; a literal that does not fit
+/// the type (for signed types, above its maximum) fails to compile.
+template <char... Chars>
+constexpr UInt128 operator""_u128() noexcept
+{
+    return detail::literal<UInt128, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr Int128 operator""_i128() noexcept
+{
+    return detail::literal<Int128, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr UInt256 operator""_u256() noexcept
+{
+    return detail::literal<UInt256, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr Int256 operator""_i256() noexcept
+{
+    return detail::literal<Int256, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr integer<512, unsigned> operator""_u512() noexcept
+{
+    return detail::literal<integer<512, unsigned>, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr integer<512, signed> operator""_i512() noexcept
+{
+    return detail::literal<integer<512, signed>, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr integer<1024, unsigned> operator""_u1024() noexcept
+{
+    return detail::literal<integer<1024, unsigned>, Chars...>::value;
+}
+
+template <char... Chars>
+constexpr integer<1024, signed> operator""_i1024() noexcept
+{
+    return detail::literal<integer<1024, signed>, Chars...>::value;
+}
+} // namespace literals
+#    endif
+
+#    if __cplusplus < 201703L
+template <size_t Bits, typename Signed>
+constexpr size_t integer<Bits, Signed>::bits;
+
+template <size_t Bits, typename Signed>
+constexpr size_t integer<Bits, Signed>::limbs;
+
+template <size_t Bits, size_t FracBits, typename Signed>
+constexpr size_t fixed<Bits, FracBits, Signed>::bits;
+
+template <size_t Bits, size_t FracBits, typename Signed>
+constexpr size_t fixed<Bits, FracBits, Signed>::frac_bits;
+#    endif
+
+#    ifdef GINT_TEST_ACCESS
+namespace detail
+{
+template <size_t Bits, typename Signed>
+struct integer_test_access
+{
+    using Int = integer<Bits, Signed>;
+    using limb_type = typename Int::limb_type;
+
+    static limb_type & limb(Int & value, size_t index) noexcept { return value.data_[index]; }
+
+    static const limb_type & limb(const Int & value, size_t index) noexcept { return value.data_[index]; }
+
+    static int highest_bit(const Int & value) noexcept { return value.highest_bit(); }
+
+    static bool is_min_value(const Int & value) noexcept { return Int::is_min_value(value); }
+
+    static Int div_unsigned_path(const Int & lhs, const Int & rhs, bool lhs_neg, bool rhs_neg, bool lhs_is_min, bool rhs_is_min)
+    {
+        return Int::div_unsigned_path(lhs, rhs, lhs_neg, rhs_neg, lhs_is_min, rhs_is_min);
+    }
+
+    static Int div_128(const Int & lhs, const Int & rhs) noexcept { return Int::div_128(lhs, rhs); }
+
+    static Int div_large(Int lhs, const Int & rhs, size_t div_limbs) noexcept { return Int::div_large(lhs, rhs, div_limbs); }
+
+    static Int rem_large(Int lhs, const Int & rhs, size_t div_limbs) noexcept { return Int::rem_large(lhs, rhs, div_limbs); }
+
+    static Int div_large_2(Int lhs, const Int & rhs) noexcept { return Int::div_large_2(lhs, rhs); }
+
+    static Int div_large_3(Int lhs, const Int & rhs) noexcept { return Int::div_large_3(lhs, rhs); }
+
+    static Int div_large_4(Int lhs, const Int & rhs) noexcept { return Int::div_large_4(lhs, rhs); }
+
+    template <typename T>
+    static int compare_with_float_abs(const Int & lhs_abs, T rhs_abs) noexcept
+    {
+        return Int::template compare_with_float_abs<T>(lhs_abs, rhs_abs);
+    }
+};
+} // namespace detail
+#    endif
+
+} // namespace GINT_DETAIL_CONFIG_NAMESPACE
+} // namespace gint
+
+#    if defined(__clang__)
+#        pragma clang diagnostic push
+#        pragma clang diagnostic ignored "-Wdeprecated-declarations"
+#    elif defined(__GNUC__)
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#    endif
+
+namespace std
+{
+template <size_t Bits, typename Signed>
+class numeric_limits<gint::integer<Bits, Signed>>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = std::is_same<Signed, signed>::value;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr int digits = static_cast<int>(Bits) - (is_signed ? 1 : 0);
+    static constexpr int digits10 = digits * 30103 / 100000;
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr gint::integer<Bits, Signed> min() noexcept { return gint::integer<Bits, Signed>::numeric_min(); }
+
+    static constexpr gint::integer<Bits, Signed> max() noexcept { return gint::integer<Bits, Signed>::numeric_max(); }
+
+    static constexpr gint::integer<Bits, Signed> lowest() noexcept { return min(); }
+    static constexpr gint::integer<Bits, Signed> epsilon() noexcept { return gint::integer<Bits, Signed>(0); }
+    static constexpr gint::integer<Bits, Signed> round_error() noexcept { return gint::integer<Bits, Signed>(0); }
+    static constexpr gint::integer<Bits, Signed> infinity() noexcept { return gint::integer<Bits, Signed>(0); }
+    static constexpr gint::integer<Bits, Signed> quiet_NaN() noexcept { return gint::integer<Bits, Signed>(0); }
+    static constexpr gint::integer<Bits, Signed> signaling_NaN() noexcept { return gint::integer<Bits, Signed>(0); }
+    static constexpr gint::integer<Bits, Signed> denorm_min() noexcept { return gint::integer<Bits, Signed>(0); }
+};
+
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_specialized;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_signed;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_integer;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_exact;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_infinity;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_quiet_NaN;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_signaling_NaN;
+template <size_t Bits, typename Signed>
+constexpr std::float_denorm_style numeric_limits<gint::integer<Bits, Signed>>::has_denorm;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::has_denorm_loss;
+template <size_t Bits, typename Signed>
+constexpr std::float_round_style numeric_limits<gint::integer<Bits, Signed>>::round_style;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_iec559;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_bounded;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::is_modulo;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::digits;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::digits10;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_digits10;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::radix;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::min_exponent;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::min_exponent10;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_exponent;
+template <size_t Bits, typename Signed>
+constexpr int numeric_limits<gint::integer<Bits, Signed>>::max_exponent10;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::traps;
+template <size_t Bits, typename Signed>
+constexpr bool numeric_limits<gint::integer<Bits, Signed>>::tinyness_before;
+
+template <size_t Bits, typename Signed>
+struct hash<gint::integer<Bits, Signed>>
+{
+    size_t operator()(const gint::integer<Bits, Signed> & value) const noexcept
+    {
+        using Int = gint::integer<Bits, Signed>;
+        size_t seed = 0;
+        for (size_t i = 0; i < Int::limbs; ++i)
+        {
+            const size_t h = std::hash<typename Int::limb_type>()(value.data_[i]);
+            seed ^= h + static_cast<size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+} // namespace std
+
+#    if defined(__clang__)
+#        pragma clang diagnostic pop
+#    elif defined(__GNUC__)
+#        pragma GCC diagnostic pop
+#    endif
+
+#endif // GINT_DETAIL_CORE_DEFINITIONS_INCLUDED
+
+#if !defined(GINT_DETAIL_CORE_ONLY) && !defined(GINT_DETAIL_IO_DEFINITIONS_INCLUDED)
+#    define GINT_DETAIL_IO_DEFINITIONS_INCLUDED
+
+// A translation unit may include <gint/core.h> first and upgrade to the
+// umbrella header later. The core pass cleans up its implementation macros, so
+// recreate the small subset needed by the string/stream/fmt extension pass.
+#    ifndef GINT_DETAIL_HEADER_PASS_ACTIVE
+#        define GINT_DETAIL_HEADER_PASS_ACTIVE
+#        if defined(__GNUC__) || defined(__clang__)
+#            define GINT_FORCE_INLINE inline __attribute__((always_inline))
+#            define GINT_NOINLINE __attribute__((noinline))
+#        else
+#            define GINT_FORCE_INLINE inline
+#            define GINT_NOINLINE
+#        endif
+#        if defined(__x86_64__) && GINT_GCC_TUNED_PATHS
+#            define GINT_WIDE_PARSE_INLINE inline GINT_NOINLINE
+#        else
+#            define GINT_WIDE_PARSE_INLINE GINT_FORCE_INLINE
+#        endif
+#        if __cplusplus >= 201402L
+#            define GINT_CONSTEXPR14 constexpr
+#        else
+#            define GINT_CONSTEXPR14
+#        endif
+#        ifdef __has_builtin
+#            define GINT_DETAIL_HAS_BUILTIN(x) __has_builtin(x)
+#        else
+#            define GINT_DETAIL_HAS_BUILTIN(x) 0
+#        endif
+#        if GINT_DETAIL_HAS_BUILTIN(__builtin_is_constant_evaluated)
+#            define GINT_HAS_IS_CONSTANT_EVALUATED 1
+#        else
+#            define GINT_HAS_IS_CONSTANT_EVALUATED 0
+#        endif
+#        if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#            define GINT_DETAIL_EXCEPTIONS_ENABLED 1
+#            define GINT_THROW(exception) throw exception
+#        else
+#            define GINT_DETAIL_EXCEPTIONS_ENABLED 0
+#            define GINT_THROW(exception) ::std::abort()
+#        endif
+#        if defined(GINT_ENABLE_DIVZERO_CHECKS)
+#            define GINT_DETAIL_DIVZERO_CHECKS 1
+#        else
+#            define GINT_DETAIL_DIVZERO_CHECKS 0
+#        endif
+#        if defined(GINT_ENABLE_DIVISION_CACHE)
+#            define GINT_DETAIL_DIVISION_CACHE 1
+#        else
+#            define GINT_DETAIL_DIVISION_CACHE 0
+#        endif
+#        if defined(GINT_ENABLE_PATH_STATS)
+#            define GINT_DETAIL_PATH_STATS 1
+#            define GINT_COUNT_PATH(counter) (++::gint::detail::path_stats_counters().counter)
+#        else
+#            define GINT_DETAIL_PATH_STATS 0
+#            define GINT_COUNT_PATH(counter) \
+                do \
+                { \
+                } while (false)
+#        endif
+#        if GINT_GCC_TUNED_PATHS
+#            define GINT_DETAIL_GCC_TUNED_POLICY 1
+#        else
+#            define GINT_DETAIL_GCC_TUNED_POLICY 0
+#        endif
+#        if GINT_CLANG_TUNED_PATHS
+#            define GINT_DETAIL_CLANG_TUNED_POLICY 1
+#        else
+#            define GINT_DETAIL_CLANG_TUNED_POLICY 0
+#        endif
+#        if GINT_ENABLE_AARCH64_LIMB_ASM
+#            define GINT_DETAIL_AARCH64_ASM_POLICY 1
+#        else
+#            define GINT_DETAIL_AARCH64_ASM_POLICY 0
+#        endif
+#        define GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
+            config_d##divzero##_r##cache##_s##stats##_g##gcc_tuned##_c##clang_tuned##_a##aarch64_asm##_e##exceptions
+#        define GINT_DETAIL_CONFIG_NAMESPACE_II(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions) \
+            GINT_DETAIL_CONFIG_NAMESPACE_I(divzero, cache, stats, gcc_tuned, clang_tuned, aarch64_asm, exceptions)
+#        define GINT_DETAIL_CONFIG_NAMESPACE \
+            GINT_DETAIL_CONFIG_NAMESPACE_II( \
+                GINT_DETAIL_DIVZERO_CHECKS, \
+                GINT_DETAIL_DIVISION_CACHE, \
+                GINT_DETAIL_PATH_STATS, \
+                GINT_DETAIL_GCC_TUNED_POLICY, \
+                GINT_DETAIL_CLANG_TUNED_POLICY, \
+                GINT_DETAIL_AARCH64_ASM_POLICY, \
+                GINT_DETAIL_EXCEPTIONS_ENABLED)
+#    endif
+
+namespace gint
+{
+inline namespace GINT_DETAIL_CONFIG_NAMESPACE
+{
+
+//=== String and stream definitions =========================================
+namespace detail
+{
+inline const char * decimal_digit_pairs() noexcept
+{
+    static const char pairs[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                   "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                   "8081828384858687888990919293949596979899";
+    return pairs;
+}
+
+// Write the low `count` decimal digits of x so that the last one lands at end[-1].
+inline void write_decimal_u64(char * end, uint64_t x, unsigned count) noexcept
+{
+    const char * pairs = decimal_digit_pairs();
+    for (; count >= 2; count -= 2)
+    {
+        const char * pair = pairs + 2 * (x % 100);
+        *--end = pair[1];
+        *--end = pair[0];
+        x /= 100;
+    }
+    if (count != 0)
+        *--end = static_cast<char>('0' + x % 10);
+}
+
+// Write exactly `digits` decimal digits of an unsigned value into
+// [first, first + digits), filling from the right. Knowing the width up front
+// removes the reversal pass; 10^19 chunks are peeled with a constant-reciprocal
+// division, and the active limb count shrinks with the value.
+template <size_t Bits>
+inline void write_decimal(char * first, integer<Bits, unsigned> value, size_t digits) noexcept
+{
+    uint64_t * u = limb_access::data(value);
+    size_t active = integer<Bits, unsigned>::limbs;
+    while (active > 1 && u[active - 1] == 0)
+        --active;
+    char * end = first + digits;
+    while (static_cast<size_t>(end - first) > 19)
+    {
+        write_decimal_u64(end, div_limbs_by_constant_u64<10000000000000000000ULL>(u, active), 19);
+        end -= 19;
+        while (active > 1 && u[active - 1] == 0)
+            --active;
+    }
+    write_decimal_u64(end, u[0], static_cast<unsigned>(end - first));
+}
+} // namespace detail
+
+template <size_t Bits, typename Signed>
+inline std::string to_string(const integer<Bits, Signed> & v)
+{
+    const bool neg = detail::constant_division_negative(v);
+    const integer<Bits, unsigned> magnitude = detail::constant_division_magnitude(v, neg);
+    const size_t digits = static_cast<size_t>(detail::decimal_digits_unsigned(magnitude));
+    GINT_COUNT_PATH(to_string_length[detail::path_stats_length_bucket(digits + neg)]);
+    std::string out(digits + neg, '-');
+    detail::write_decimal(&out[neg], magnitude, digits);
+    return out;
+}
+
+/// Result of `to_chars`, mirroring `std::to_chars_result`.
+struct to_chars_result
+{
+    char * ptr;
+    std::errc ec;
+};
+
+/// Write the decimal representation of `value` into `[first, last)` without a
+/// terminating null. On success `ptr` is one past the last character written;
+/// when the range is too small `ec` is `std::errc::value_too_large`, `ptr` is
+/// `last`, and the range contents are unspecified.
+template <size_t Bits, typename Signed>
+inline to_chars_result to_chars(char * first, char * last, const integer<Bits, Signed> & value) noexcept
+{
+    const bool neg = detail::constant_division_negative(value);
+    const integer<Bits, unsigned> magnitude = detail::constant_division_magnitude(value, neg);
+    const size_t digits = static_cast<size_t>(detail::decimal_digits_unsigned(magnitude));
+    if (static_cast<size_t>(last - first) < digits + neg)
+        return to_chars_result{last, std::errc::value_too_large};
+    if (neg)
+        *first++ = '-';
+    detail::write_decimal(first, magnitude, digits);
+    return to_chars_result{first + digits, std::errc()};
+}
+
+namespace detail
+{
+GINT_CONSTEXPR14 inline unsigned string_digit_value(char c) noexcept
+{
+    const unsigned value = static_cast<unsigned>(static_cast<unsigned char>(c));
+    const unsigned decimal = value - static_cast<unsigned>('0');
+    if (decimal <= 9u)
+        return decimal;
+    const unsigned alpha = (value | 0x20u) - static_cast<unsigned>('a');
+    return alpha < 26u ? alpha + 10u : 36u;
+}
+
+inline unsigned hexadecimal_digit_value(unsigned value) noexcept
+{
+    // Full byte-domain table keeps validation and decoding to one load and one
+    // range check. Constant initialization emits read-only data with no guard.
+    static const unsigned char digits[256] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 10,
+        11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 10,   11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    return digits[value];
+}
+
+GINT_CONSTEXPR14 inline void detect_parse_base(const char * end, const char *& pos, unsigned & base)
+{
+    if (base != 0 && (base < 2 || base > 36))
+        GINT_THROW(std::invalid_argument("gint::from_string invalid base"));
+
+    if (base == 0)
+    {
+        if (end - pos >= 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X'))
+        {
+            base = 16;
+            pos += 2;
+        }
+        else if (end - pos >= 2 && pos[0] == '0' && (pos[1] == 'b' || pos[1] == 'B'))
+        {
+            base = 2;
+            pos += 2;
+        }
+        else if (end - pos >= 2 && pos[0] == '0')
+        {
+            base = 8;
+        }
+        else
+        {
+            base = 10;
+        }
+        return;
+    }
+
+    if (base == 16 && end - pos >= 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X'))
+        pos += 2;
+    else if (base == 2 && end - pos >= 2 && pos[0] == '0' && (pos[1] == 'b' || pos[1] == 'B'))
+        pos += 2;
+}
+
+inline char format_digit(unsigned digit, bool uppercase) noexcept
+{
+    return static_cast<char>((digit < 10) ? ('0' + digit) : ((uppercase ? 'A' : 'a') + (digit - 10)));
+}
+
+inline size_t stream_prefix_size(const std::string & text) noexcept
+{
+    if (text.empty())
+        return 0;
+    if (text[0] == '-' || text[0] == '+')
+        return 1;
+    if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+        return 2;
+    return 0;
+}
+
+inline std::ostream & write_formatted_string(std::ostream & out, const std::string & text)
+{
+    const std::streamsize width = out.width(0);
+    const std::streamsize size = static_cast<std::streamsize>(text.size());
+    if (width <= size)
+        return out.write(text.data(), size);
+
+    const std::streamsize padding = width - size;
+    const char fill = out.fill();
+    const std::ios_base::fmtflags adjust = out.flags() & std::ios_base::adjustfield;
+    const size_t prefix = (adjust == std::ios_base::internal) ? stream_prefix_size(text) : 0;
+
+    if (adjust == std::ios_base::left)
+    {
+        out.write(text.data(), size);
+        for (std::streamsize i = 0; i < padding; ++i)
+            out.put(fill);
+        return out;
+    }
+
+    if (prefix)
+        out.write(text.data(), static_cast<std::streamsize>(prefix));
+    for (std::streamsize i = 0; i < padding; ++i)
+        out.put(fill);
+    out.write(text.data() + prefix, size - static_cast<std::streamsize>(prefix));
+    return out;
+}
+
+template <size_t Bits, typename Signed>
+inline std::string to_base_string(const integer<Bits, Signed> & value, unsigned base, bool uppercase)
+{
+    if (base == 10)
+        return to_string(value);
+
+    const unsigned bits_per_digit = (base == 16) ? 4 : (base == 8) ? 3 : 1;
+    const unsigned mask = (1u << bits_per_digit) - 1u;
+    const size_t digit_count = (Bits + bits_per_digit - 1) / bits_per_digit;
+    std::string out;
+    out.reserve(digit_count);
+
+    bool seen = false;
+    for (size_t digit_index = digit_count; digit_index-- > 0;)
+    {
+        const size_t bit = digit_index * bits_per_digit;
+        const size_t limb_index = bit / 64;
+        const unsigned shift = static_cast<unsigned>(bit % 64);
+        unsigned digit = static_cast<unsigned>((value.data_[limb_index] >> shift) & mask);
+        if (shift + bits_per_digit > 64 && limb_index + 1 < integer<Bits, Signed>::limbs)
+            digit |= static_cast<unsigned>(value.data_[limb_index + 1] << (64 - shift)) & mask;
+
+        const unsigned valid_bits = static_cast<unsigned>((Bits - bit < bits_per_digit) ? (Bits - bit) : bits_per_digit);
+        digit &= (1u << valid_bits) - 1u;
+
+        if (digit || seen)
+        {
+            out.push_back(format_digit(digit, uppercase));
+            seen = true;
+        }
+    }
+
+    return seen ? out : std::string("0");
+}
+
+template <size_t Bits, typename Signed>
+inline std::string format_stream_value(const integer<Bits, Signed> & value, const std::ios_base::fmtflags flags)
+{
+    const std::ios_base::fmtflags basefield = flags & std::ios_base::basefield;
+    const bool uppercase = (flags & std::ios_base::uppercase) != 0;
+    unsigned base = 10;
+    if (basefield == std::ios_base::hex)
+        base = 16;
+    else if (basefield == std::ios_base::oct)
+        base = 8;
+
+    std::string text = to_base_string(value, base, uppercase);
+    if (base == 10)
+    {
+        if ((flags & std::ios_base::showpos) && (text.empty() || text[0] != '-'))
+            text.insert(text.begin(), '+');
+        return text;
+    }
+
+    if ((flags & std::ios_base::showbase) && text != "0")
+    {
+        if (base == 16)
+            text.insert(0, uppercase ? "0X" : "0x");
+        else if (base == 8 && text[0] != '0')
+            text.insert(text.begin(), '0');
+    }
+    return text;
+}
+
+template <unsigned BitsPerDigit, size_t Bits, typename Signed>
+GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range(const char * begin, const char * end)
+{
+    using Int = integer<Bits, Signed>;
+    using limb_type = typename Int::limb_type;
+    const unsigned base = 1u << BitsPerDigit;
+    const size_t chunk_digits = 64u / BitsPerDigit;
+
+    Int result;
+    const char * cursor = begin;
+    size_t digits_left = static_cast<size_t>(end - begin);
+    size_t current_chunk_digits = digits_left % chunk_digits;
+    if (current_chunk_digits == 0)
+        current_chunk_digits = chunk_digits;
+    bool first_chunk = true;
+
+    while (digits_left != 0)
+    {
+        limb_type chunk = 0;
+        for (size_t i = 0; i < current_chunk_digits; ++i)
+        {
+            const unsigned value = static_cast<unsigned>(static_cast<unsigned char>(*cursor++));
+            const unsigned digit = BitsPerDigit == 4u ? hexadecimal_digit_value(value) : value - static_cast<unsigned>('0');
+            if (digit >= base)
+                GINT_THROW(std::invalid_argument("gint::from_string invalid digit"));
+            chunk = (chunk << BitsPerDigit) | digit;
+        }
+
+        digits_left -= current_chunk_digits;
+        if (Int::limbs <= 4)
+        {
+            if (first_chunk)
+            {
+                result.data_[0] = chunk;
+                first_chunk = false;
+            }
+            else
+            {
+                const unsigned shift = static_cast<unsigned>(current_chunk_digits * BitsPerDigit);
+                if (shift == 64u)
+                {
+                    for (size_t i = Int::limbs; i-- > 1;)
+                        result.data_[i] = result.data_[i - 1];
+                    result.data_[0] = chunk;
+                }
+                else
+                {
+                    const unsigned inv_shift = 64u - shift;
+                    for (size_t i = Int::limbs; i-- > 1;)
+                        result.data_[i] = (result.data_[i] << shift) | (result.data_[i - 1] >> inv_shift);
+                    result.data_[0] = (result.data_[0] << shift) | chunk;
+                }
+            }
+        }
+        else if (digits_left <= Bits / BitsPerDigit)
+        {
+            const size_t bit_offset = digits_left * BitsPerDigit;
+            if (bit_offset < Bits)
+            {
+                const size_t limb_index = bit_offset / 64u;
+                const unsigned shift = static_cast<unsigned>(bit_offset % 64u);
+                result.data_[limb_index] |= chunk << shift;
+                if (shift && limb_index + 1 < Int::limbs)
+                    result.data_[limb_index + 1] |= chunk >> (64u - shift);
+            }
+        }
+        current_chunk_digits = chunk_digits;
+    }
+    return result;
+}
+
+template <unsigned BitsPerDigit, size_t Bits, typename Signed>
+GINT_WIDE_PARSE_INLINE integer<Bits, Signed> parse_wide_power_of_two_range(const char * begin, const char * end)
+{
+    // GCC/x86 is sensitive to the layout of this large parser when it is
+    // merged into parse_string_range. Keep wide power-of-two parsing in its
+    // own code-generation unit; other compiler/architecture pairs inline it.
+    return parse_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+}
+
+template <unsigned BitsPerDigit, size_t Bits, typename Signed>
+GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range_selected(const char * begin, const char * end, std::false_type)
+{
+    return parse_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+}
+
+template <unsigned BitsPerDigit, size_t Bits, typename Signed>
+GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range_selected(const char * begin, const char * end, std::true_type)
+{
+    return parse_wide_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+}
+
+template <size_t Bits, typename Signed>
+inline integer<Bits, Signed> parse_string_range(const char * begin, const char * end, unsigned base)
+{
+    if (begin == end)
+        GINT_THROW(std::invalid_argument("gint::from_string empty string"));
+
+    const char * pos = begin;
+    bool negative = false;
+    if (*pos == '+' || *pos == '-')
+    {
+        negative = *pos == '-';
+        ++pos;
+        if (pos == end)
+            GINT_THROW(std::invalid_argument("gint::from_string sign without digits"));
+    }
+
+    detect_parse_base(end, pos, base);
+    if (pos == end)
+        GINT_THROW(std::invalid_argument("gint::from_string prefix without digits"));
+    GINT_COUNT_PATH(parse_base[base]);
+    GINT_COUNT_PATH(parse_length[path_stats_length_bucket(static_cast<size_t>(end - pos))]);
+
+    using Int = integer<Bits, Signed>;
+    using limb_type = typename Int::limb_type;
+
+    // Fixed-width parsing of power-of-two bases is pure bit packing. Work from
+    // 64-bit digit chunks and place them directly into the destination limbs,
+    // so over-width input naturally wraps modulo 2^Bits.
+    if (base == 2)
+    {
+        Int result = parse_power_of_two_range_selected<1, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
+        return negative ? -result : result;
+    }
+    if (base == 8)
+    {
+        Int result = parse_power_of_two_range_selected<3, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
+        return negative ? -result : result;
+    }
+    if (base == 16)
+    {
+        Int result = parse_power_of_two_range_selected<4, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
+        return negative ? -result : result;
+    }
+
+    const limb_type max_limb = std::numeric_limits<limb_type>::max();
+    limb_type chunk_base = 1;
+    size_t chunk_digits = 0;
+    while (chunk_base <= max_limb / base)
+    {
+        chunk_base *= base;
+        ++chunk_digits;
+    }
+
+    Int result;
+    bool first_chunk = true;
+    size_t digits_left = static_cast<size_t>(end - pos);
+    size_t current_chunk_digits = digits_left % chunk_digits;
+    if (current_chunk_digits == 0)
+        current_chunk_digits = chunk_digits;
+
+    while (digits_left != 0)
+    {
+        limb_type chunk = 0;
+        for (size_t i = 0; i < current_chunk_digits; ++i, ++pos)
+        {
+            const unsigned digit = string_digit_value(*pos);
+            if (digit >= base)
+                GINT_THROW(std::invalid_argument("gint::from_string invalid digit"));
+            chunk = chunk * base + digit;
+        }
+        if (first_chunk)
+        {
+            result = chunk;
+            first_chunk = false;
+        }
+        else
+        {
+            result.mul_add_limb(chunk_base, chunk);
+        }
+        digits_left -= current_chunk_digits;
+        current_chunk_digits = chunk_digits;
+    }
+
+    return negative ? -result : result;
+}
+
+// Constant-evaluation parser: the grammar and errors of parse_string_range,
+// folding one digit at a time through the constexpr * and +.
+template <size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> parse_string_constexpr(const char * begin, const char * end, unsigned base)
+{
+    if (begin == end)
+        GINT_THROW(std::invalid_argument("gint::from_string empty string"));
+
+    const char * pos = begin;
+    bool negative = false;
+    if (*pos == '+' || *pos == '-')
+    {
+        negative = *pos == '-';
+        ++pos;
+        if (pos == end)
+            GINT_THROW(std::invalid_argument("gint::from_string sign without digits"));
+    }
+
+    detect_parse_base(end, pos, base);
+    if (pos == end)
+        GINT_THROW(std::invalid_argument("gint::from_string prefix without digits"));
+
+    using Int = integer<Bits, Signed>;
+    Int result;
+    for (; pos != end; ++pos)
+    {
+        const unsigned digit = string_digit_value(*pos);
+        if (digit >= base)
+            GINT_THROW(std::invalid_argument("gint::from_string invalid digit"));
+        result = result * Int(base) + Int(digit);
+    }
+    return negative ? -result : result;
+}
+} // namespace detail
+
+template <size_t Bits, typename Signed>
+inline integer<Bits, Signed> from_string(const std::string & text, unsigned base)
+{
+    return detail::parse_string_range<Bits, Signed>(text.data(), text.data() + text.size(), base);
+}
+
+template <size_t Bits, typename Signed>
+GINT_CONSTEXPR14 integer<Bits, Signed> from_string(const char * text, unsigned base)
+{
+    if (!text)
+        GINT_THROW(std::invalid_argument("gint::from_string null string"));
+#    if GINT_HAS_IS_CONSTANT_EVALUATED && __cplusplus >= 201402L
+    if (__builtin_is_constant_evaluated())
+    {
+        const char * end = text;
+        while (*end != '\0')
+            ++end;
+        return detail::parse_string_constexpr<Bits, Signed>(text, end, base);
+    }
+#    endif
+    return detail::parse_string_range<Bits, Signed>(text, text + std::strlen(text), base);
+}
+
+template <typename Int>
+inline Int from_string(const std::string & text, unsigned base)
+{
+    return from_string<Int::bits, typename Int::signed_tag>(text, base);
+}
+
+template <typename Int>
+GINT_CONSTEXPR14 Int from_string(const char * text, unsigned base)
+{
+    return from_string<Int::bits, typename Int::signed_tag>(text, base);
+}
+
+template <size_t Bits, typename Signed>
+inline std::ostream & operator<<(std::ostream & out, const integer<Bits, Signed> & value)
+{
+    const std::string text = detail::format_stream_value(value, out.flags());
+    return detail::write_formatted_string(out, text);
+} // LCOV_EXCL_LINE
+
+//=== Packed storage =========================================================
+
+template <size_t StoredBits, typename Integer>
+class packed_array;
+
+/// Dense sequence of `integer<Bits, Signed>` values that keeps only the low
+/// `StoredBits` bits of each element, `StoredBits / 8` bytes apiece with no
+/// padding: a 160-bit address takes 20 bytes instead of a 32-byte `UInt256`.
+///
+/// Stores truncate like a narrowing conversion; loads zero-extend unsigned and
+/// sign-extend signed elements, so every value that fits in `StoredBits`
+/// round-trips. Elements are accessed with unaligned byte copies. `unpack` and
+/// `pack` move ranges through aligned `value_type` buffers for arithmetic, and
+/// `find` / `count` compare in the packed form without unpacking.
+template <size_t StoredBits, size_t Bits, typename Signed>
+class packed_array<StoredBits, integer<Bits, Signed>>
+{
+    static_assert(StoredBits > 0 && StoredBits % 8 == 0, "StoredBits must be a positive multiple of 8");
+    static_assert(StoredBits <= Bits, "StoredBits must not exceed the element width");
+#    if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "packed_array copies limbs as little-endian bytes");
+#    endif
+
+public:
+    using value_type = integer<Bits, Signed>;
+    using size_type = size_t;
+    static constexpr size_t stored_bits = StoredBits;
+    /// Bytes per element.
+    static constexpr size_t stride = StoredBits / 8;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    packed_array() = default;
+
+    /// `count` zero elements.
+    explicit packed_array(size_t count) : bytes_(count * stride) { }
+
+    packed_array(size_t count, const value_type & value) : bytes_(count * stride)
+    {
+        for (size_t i = 0; i < count; ++i)
+            store(bytes_.data() + i * stride, value);
+    }
+
+    size_t size() const noexcept { return bytes_.size() / stride; }
+
+    bool empty() const noexcept { return bytes_.empty(); }
+
+    /// Bytes occupied by the elements, excluding spare capacity.
+    size_t size_bytes() const noexcept { return bytes_.size(); }
+
+    size_t capacity() const noexcept { return bytes_.capacity() / stride; }
+
+    const unsigned char * data() const noexcept { return bytes_.data(); }
+
+    unsigned char * data() noexcept { return bytes_.data(); }
+
+    void reserve(size_t count) { bytes_.reserve(count * stride); }
+
+    /// New elements are zero.
+    void resize(size_t count) { bytes_.resize(count * stride); }
+
+    void clear() noexcept { bytes_.clear(); }
+
+    void shrink_to_fit() { bytes_.shrink_to_fit(); }
+
+    void push_back(const value_type & value)
+    {
+        bytes_.resize(bytes_.size() + stride);
+        store(bytes_.data() + bytes_.size() - stride, value);
+    }
+
+    value_type operator[](size_t index) const noexcept
+    {
+        value_type result;
+        load(result, bytes_.data() + index * stride);
+        return result;
+    }
+
+    void set(size_t index, const value_type & value) noexcept { store(bytes_.data() + index * stride, value); }
+
+    /// Copy elements [first, first + count) into `out`.
+    void unpack(size_t first, size_t count, value_type * out) const noexcept
+    {
+        const unsigned char * source = bytes_.data() + first * stride;
+        for (size_t i = 0; i < count; ++i)
+            load(out[i], source + i * stride);
+    }
+
+    /// Overwrite elements [first, first + count) from `in`.
+    void pack(size_t first, size_t count, const value_type * in) noexcept
+    {
+        unsigned char * target = bytes_.data() + first * stride;
+        for (size_t i = 0; i < count; ++i)
+            store(target + i * stride, in[i]);
+    }
+
+    /// Index of the first element at or after `first` whose stored bits equal
+    /// those of `value` truncated to `StoredBits`, or `npos`.
+    size_t find(const value_type & value, size_t first = 0) const noexcept
+    {
+        uint64_t key[key_words];
+        make_key(key, value);
+        const unsigned char * base = bytes_.data();
+        const size_t n = size();
+        size_t i = first;
+        // Eight elements per step without a branch per element; the compare
+        // is a fixed sequence of word loads, so the block unrolls completely.
+        for (; i + 8 <= n; i += 8)
+        {
+            unsigned mask = 0;
+            for (size_t j = 0; j < 8; ++j)
+                mask |= static_cast<unsigned>(matches(base + (i + j) * stride, key)) << j;
+            if (mask != 0)
+                return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+        for (; i < n; ++i)
+        {
+            if (matches(base + i * stride, key))
+                return i;
+        }
+        return npos;
+    }
+
+    /// Number of elements whose stored bits equal those of `value` truncated
+    /// to `StoredBits`.
+    size_t count(const value_type & value) const noexcept
+    {
+        uint64_t key[key_words];
+        make_key(key, value);
+        const unsigned char * base = bytes_.data();
+        const size_t n = size();
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i)
+            total += static_cast<size_t>(matches(base + i * stride, key));
+        return total;
+    }
+
+private:
+    static constexpr size_t full_words = stride / 8;
+    // Elements of eight bytes or more compare as whole words, the last one
+    // overlapping its predecessor when stride is not a multiple of eight.
+    static constexpr size_t key_words = stride < 8 ? 1 : full_words + (stride % 8 != 0);
+
+    static GINT_FORCE_INLINE uint64_t load_word(const unsigned char * element, size_t word) noexcept
+    {
+        uint64_t result = 0;
+        if (stride < 8)
+            std::memcpy(&result, element, stride < 8 ? stride : 8);
+        else
+            std::memcpy(&result, element + (word < full_words ? 8 * word : stride - 8), 8);
+        return result;
+    }
+
+    static GINT_FORCE_INLINE bool matches(const unsigned char * element, const uint64_t * key) noexcept
+    {
+        uint64_t difference = 0;
+        for (size_t word = 0; word < key_words; ++word)
+            difference |= load_word(element, word) ^ key[word];
+        return difference == 0;
+    }
+
+    static void make_key(uint64_t * key, const value_type & value) noexcept
+    {
+        unsigned char element[stride];
+        store(element, value);
+        for (size_t word = 0; word < key_words; ++word)
+            key[word] = load_word(element, word);
+    }
+
+    static GINT_FORCE_INLINE void load(value_type & result, const unsigned char * element) noexcept
+    {
+        uint64_t * limbs = detail::limb_access::data(result);
+        // Assemble each limb in a register; copying the bytes over a zeroed
+        // value stalls on store forwarding when the copy ends mid-limb.
+        for (size_t i = 0; i < value_type::limbs; ++i)
+        {
+            uint64_t limb = 0;
+            if (8 * (i + 1) <= stride)
+                std::memcpy(&limb, element + 8 * i, 8);
+            else if (8 * i < stride)
+                std::memcpy(&limb, element + 8 * i, stride % 8);
+            limbs[i] = limb;
+        }
+        if (std::is_same<Signed, signed>::value && StoredBits < Bits)
+        {
+            const size_t top = (stride - 1) / 8;
+            const unsigned unused = static_cast<unsigned>(64 * (top + 1) - StoredBits);
+            const uint64_t extended = static_cast<uint64_t>(static_cast<int64_t>(limbs[top] << unused) >> unused);
+            limbs[top] = extended;
+            const uint64_t fill = (extended >> 63) != 0 ? ~uint64_t(0) : 0;
+            for (size_t i = top + 1; i < value_type::limbs; ++i)
+                limbs[i] = fill;
+        }
+    }
+
+    static GINT_FORCE_INLINE void store(unsigned char * element, const value_type & value) noexcept
+    {
+        std::memcpy(element, detail::limb_access::data(value), stride);
+    }
+
+    std::vector<unsigned char> bytes_;
+};
+
+#    if __cplusplus < 201703L
+template <size_t StoredBits, size_t Bits, typename Signed>
+constexpr size_t packed_array<StoredBits, integer<Bits, Signed>>::stored_bits;
+
+template <size_t StoredBits, size_t Bits, typename Signed>
+constexpr size_t packed_array<StoredBits, integer<Bits, Signed>>::stride;
+
+template <size_t StoredBits, size_t Bits, typename Signed>
+constexpr size_t packed_array<StoredBits, integer<Bits, Signed>>::npos;
+
+template <size_t StoredBits, size_t Bits, typename Signed>
+constexpr size_t packed_array<StoredBits, integer<Bits, Signed>>::full_words;
+
+template <size_t StoredBits, size_t Bits, typename Signed>
+constexpr size_t packed_array<StoredBits, integer<Bits, Signed>>::key_words;
 #    endif
 
-namespace gint
-{
-inline namespace GINT_DETAIL_CONFIG_NAMESPACE
-{
+//=== Column storage =========================================================
 
-//=== String and stream definitions =========================================
+/// Limb-planar (structure-of-arrays) sequence of `integer<Bits, Signed>`
+/// values: limb 0 of every row is contiguous, then limb 1, and so on, so
+/// row-wise add/sub and comparisons run across rows in SIMD lanes instead of
+/// along one value's carry chain.
+///
+/// `+=`, `-=`, `+` and `-` wrap like `integer`; `equal_mask` / `less_mask`
+/// write one byte (0 or 1) per row, and `min` / `max` select per row. Binary
+/// operations require columns of equal size. Rows convert to and from `integer`
+/// arrays with `pack` / `unpack`, and `plane(limb)` exposes the raw limbs.
 template <size_t Bits, typename Signed>
-inline std::string to_string(const integer<Bits, Signed> & v)
+class column
 {
-    integer<Bits, Signed> tmp = v;
-    bool neg = false;
-    if (std::is_same<Signed, signed>::value && (v.data_[integer<Bits, Signed>::limbs - 1] >> 63))
+public:
+    using value_type = integer<Bits, Signed>;
+    using size_type = size_t;
+    static constexpr size_t limbs = value_type::limbs;
+
+    column() = default;
+
+    /// `count` zero rows.
+    explicit column(size_t count) { resize(count); }
+
+    column(size_t count, const value_type & value)
     {
-        tmp = -v;
-        neg = true;
+        const uint64_t * source = detail::limb_access::data(value);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb].assign(count, source[limb]);
     }
-    if (tmp.is_zero())
-        return "0";
 
-    using Int = integer<Bits, Signed>;
-    const typename Int::limb_type base = 10000000000000000000ULL; // 1e19
-    const unsigned chunk_digits = 19;
+    /// Rows copied from the `count` values at `values`.
+    column(const value_type * values, size_t count)
+    {
+        resize(count);
+        pack(0, count, values);
+    }
+
+    size_t size() const noexcept { return planes_[0].size(); }
 
-    constexpr size_t max_chunks = (Bits + 62) / 63;
-    std::array<typename Int::limb_type, max_chunks> chunks = {{}};
-    size_t chunk_count = 0;
-    while (!tmp.is_zero())
+    bool empty() const noexcept { return planes_[0].empty(); }
+
+    void reserve(size_t count)
     {
-        Int q;
-        typename Int::limb_type rem = tmp.div_mod_small(base, q);
-        chunks[chunk_count++] = rem;
-        tmp = q;
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb].reserve(count);
     }
 
-    std::string out;
-    out.reserve(chunk_count * chunk_digits + 1);
-    // most significant chunk
+    /// New rows are zero.
+    void resize(size_t count)
+    {
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb].resize(count);
+    }
+
+    void clear() noexcept
+    {
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb].clear();
+    }
+
+    void push_back(const value_type & value)
+    {
+        const uint64_t * source = detail::limb_access::data(value);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb].push_back(source[limb]);
+    }
+
+    /// Limb `limb` of every row, `size()` words.
+    const uint64_t * plane(size_t limb) const noexcept { return planes_[limb].data(); }
+
+    uint64_t * plane(size_t limb) noexcept { return planes_[limb].data(); }
+
+    value_type operator[](size_t index) const noexcept
+    {
+        value_type result;
+        uint64_t * target = detail::limb_access::data(result);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            target[limb] = planes_[limb][index];
+        return result;
+    }
+
+    void set(size_t index, const value_type & value) noexcept
+    {
+        const uint64_t * source = detail::limb_access::data(value);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            planes_[limb][index] = source[limb];
+    }
+
+    /// Copy rows [first, first + count) into `out`.
+    void unpack(size_t first, size_t count, value_type * out) const noexcept
     {
-        char buf[32];
-        unsigned idx = 32;
-        typename Int::limb_type x = chunks[chunk_count - 1];
-        while (x)
+        for (size_t limb = 0; limb < limbs; ++limb)
         {
-            buf[--idx] = static_cast<char>('0' + (x % 10));
-            x /= 10;
+            const uint64_t * source = planes_[limb].data() + first;
+            for (size_t i = 0; i < count; ++i)
+                detail::limb_access::data(out[i])[limb] = source[i];
         }
-        out.append(buf + idx, 32 - idx);
     }
-    // zero-padded remaining chunks
-    for (size_t chunk_index = chunk_count - 1; chunk_index-- > 0;)
+
+    /// Overwrite rows [first, first + count) from `in`.
+    void pack(size_t first, size_t count, const value_type * in) noexcept
     {
-        char buf[32];
-        unsigned idx = 32;
-        typename Int::limb_type x = chunks[chunk_index];
-        for (unsigned i = 0; i < chunk_digits; ++i)
+        for (size_t limb = 0; limb < limbs; ++limb)
         {
-            buf[--idx] = static_cast<char>('0' + (x % 10));
-            x /= 10;
+            uint64_t * target = planes_[limb].data() + first;
+            for (size_t i = 0; i < count; ++i)
+                target[i] = detail::limb_access::data(in[i])[limb];
         }
-        out.append(buf + idx, chunk_digits);
     }
-    if (neg)
-        out.insert(out.begin(), '-');
-    return out;
-}
+
+private:
+    std::array<std::vector<uint64_t>, limbs> planes_;
+};
+
+#    if __cplusplus < 201703L
+template <size_t Bits, typename Signed>
+constexpr size_t column<Bits, Signed>::limbs;
+#    endif
+
+// Column kernels keep one group of rows in registers while walking the limb
+// planes. Carries, borrows and comparison results are lane masks (all ones or
+// zero), so the same code serves a scalar row and a vector of rows: adding a
+// carry mask subtracts it. Vectors use the GCC/Clang vector extension, which
+// lowers to AVX2 on x86_64 and Advanced SIMD on AArch64; other targets, and
+// GCC releases before 5, run the scalar form one row at a time.
+//
+// The lane width follows the target flags, so the kernels and the column
+// operations built on them live in an inline namespace named after it. A
+// -mavx2 translation unit and a baseline one then emit distinct symbols for
+// them, while `column` and `integer` stay the same types in both.
+#    if (defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5) && defined(__x86_64__) && defined(__AVX2__)
+#        define GINT_DETAIL_COLUMN_LANES 1
+#        define GINT_DETAIL_COLUMN_LANE_NAMESPACE lanes_avx2
+#    elif (defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5) && defined(__aarch64__)
+#        define GINT_DETAIL_COLUMN_LANES 1
+#        define GINT_DETAIL_COLUMN_LANE_NAMESPACE lanes_neon
+#    else
+#        define GINT_DETAIL_COLUMN_LANES 0
+#        define GINT_DETAIL_COLUMN_LANE_NAMESPACE lanes_scalar
+#    endif
 
 namespace detail
 {
-inline unsigned string_digit_value(char c) noexcept
+template <size_t Bits, typename Signed>
+GINT_FORCE_INLINE std::array<const uint64_t *, column<Bits, Signed>::limbs> column_planes(const column<Bits, Signed> & values) noexcept
 {
-    const unsigned value = static_cast<unsigned>(static_cast<unsigned char>(c));
-    const unsigned decimal = value - static_cast<unsigned>('0');
-    if (decimal <= 9u)
-        return decimal;
-    const unsigned alpha = (value | 0x20u) - static_cast<unsigned>('a');
-    return alpha < 26u ? alpha + 10u : 36u;
+    std::array<const uint64_t *, column<Bits, Signed>::limbs> result;
+    for (size_t limb = 0; limb < result.size(); ++limb)
+        result[limb] = values.plane(limb);
+    return result;
 }
 
-inline unsigned hexadecimal_digit_value(unsigned value) noexcept
+template <size_t Bits, typename Signed>
+GINT_FORCE_INLINE std::array<uint64_t *, column<Bits, Signed>::limbs> column_planes(column<Bits, Signed> & values) noexcept
 {
-    // Full byte-domain table keeps validation and decoding to one load and one
-    // range check. Constant initialization emits read-only data with no guard.
-    static const unsigned char digits[256] = {
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 10,
-        11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 10,   11,   12,   13,   14,   15,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-    return digits[value];
+    std::array<uint64_t *, column<Bits, Signed>::limbs> result;
+    for (size_t limb = 0; limb < result.size(); ++limb)
+        result[limb] = values.plane(limb);
+    return result;
 }
 
-inline void detect_parse_base(const char * end, const char *& pos, unsigned & base)
+// Replace `best` with `value` when it lies beyond it, selecting by mask.
+template <bool Maximum, size_t Bits, typename Signed>
+GINT_FORCE_INLINE void column_keep_extreme(integer<Bits, Signed> & best, const integer<Bits, Signed> & value) noexcept
 {
-    if (base != 0 && (base < 2 || base > 36))
-        GINT_THROW(std::invalid_argument("gint::from_string invalid base"));
+    const uint64_t take = 0 - static_cast<uint64_t>(Maximum ? best < value : value < best);
+    uint64_t * target = limb_access::data(best);
+    const uint64_t * source = limb_access::data(value);
+    for (size_t i = 0; i < integer<Bits, Signed>::limbs; ++i)
+        target[i] = (source[i] & take) | (target[i] & ~take);
+}
 
-    if (base == 0)
+// Row `lhs` < row `rhs`, stopping at the first differing limb from the top.
+template <typename Signed, size_t Limbs>
+GINT_FORCE_INLINE bool column_row_less(const std::array<const uint64_t *, Limbs> & planes, size_t lhs, size_t rhs) noexcept
+{
+    for (size_t limb = Limbs; limb-- > 0;)
     {
-        if (end - pos >= 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X'))
-        {
-            base = 16;
-            pos += 2;
-        }
-        else if (end - pos >= 2 && pos[0] == '0' && (pos[1] == 'b' || pos[1] == 'B'))
+        const uint64_t x = planes[limb][lhs];
+        const uint64_t y = planes[limb][rhs];
+        if (x != y)
+            return std::is_same<Signed, signed>::value && limb + 1 == Limbs ? static_cast<int64_t>(x) < static_cast<int64_t>(y) : x < y;
+    }
+    return false;
+}
+
+inline namespace GINT_DETAIL_COLUMN_LANE_NAMESPACE
+{
+#    if GINT_DETAIL_COLUMN_LANES
+#        if defined(__AVX2__)
+typedef uint64_t column_lanes __attribute__((vector_size(32)));
+#        else
+typedef uint64_t column_lanes __attribute__((vector_size(16)));
+#        endif
+constexpr size_t column_lane_rows = sizeof(column_lanes) / 8;
+
+GINT_FORCE_INLINE column_lanes column_below(column_lanes lhs, column_lanes rhs) noexcept
+{
+    return (column_lanes)(lhs < rhs);
+}
+
+GINT_FORCE_INLINE column_lanes column_same(column_lanes lhs, column_lanes rhs) noexcept
+{
+    return (column_lanes)(lhs == rhs);
+}
+#    endif
+
+GINT_FORCE_INLINE uint64_t column_below(uint64_t lhs, uint64_t rhs) noexcept
+{
+    return 0 - static_cast<uint64_t>(lhs < rhs);
+}
+
+GINT_FORCE_INLINE uint64_t column_same(uint64_t lhs, uint64_t rhs) noexcept
+{
+    return 0 - static_cast<uint64_t>(lhs == rhs);
+}
+
+template <typename Lanes>
+GINT_FORCE_INLINE Lanes column_load(const uint64_t * source) noexcept
+{
+    Lanes result;
+    std::memcpy(&result, source, sizeof(result));
+    return result;
+}
+
+template <typename Lanes>
+GINT_FORCE_INLINE void column_store(uint64_t * target, const Lanes & value) noexcept
+{
+    std::memcpy(target, &value, sizeof(value));
+}
+
+template <size_t Limbs, bool Subtract, typename Lanes>
+GINT_FORCE_INLINE void column_add_sub_rows(uint64_t * const * out, const uint64_t * const * rhs, size_t row) noexcept
+{
+    Lanes carry = Lanes();
+    for (size_t limb = 0; limb < Limbs; ++limb)
+    {
+        const Lanes x = column_load<Lanes>(out[limb] + row);
+        const Lanes y = column_load<Lanes>(rhs[limb] + row);
+        if (Subtract)
         {
-            base = 2;
-            pos += 2;
+            const Lanes difference = x - y;
+            const Lanes total = difference + carry;
+            column_store(out[limb] + row, total);
+            carry = column_below(x, difference) | column_below(difference, total);
         }
-        else if (end - pos >= 2 && pos[0] == '0')
+        else
         {
-            base = 8;
+            const Lanes sum = x + y;
+            const Lanes total = sum - carry;
+            column_store(out[limb] + row, total);
+            carry = column_below(sum, x) | column_below(total, sum);
         }
-        else
+    }
+}
+
+// Lane mask of lhs < rhs, from the low plane up; the top plane of a signed
+// column compares with its sign bits flipped.
+template <size_t Limbs, bool IsSigned, typename Lanes>
+GINT_FORCE_INLINE Lanes column_less_rows(const uint64_t * const * lhs, const uint64_t * const * rhs, size_t row) noexcept
+{
+    Lanes less = Lanes();
+    for (size_t limb = 0; limb < Limbs; ++limb)
+    {
+        Lanes x = column_load<Lanes>(lhs[limb] + row);
+        Lanes y = column_load<Lanes>(rhs[limb] + row);
+        if (IsSigned && limb + 1 == Limbs)
         {
-            base = 10;
+            const Lanes top = Lanes() + (uint64_t(1) << 63);
+            x ^= top;
+            y ^= top;
         }
-        return;
+        less = column_below(x, y) | (column_same(x, y) & less);
     }
+    return less;
+}
 
-    if (base == 16 && end - pos >= 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X'))
-        pos += 2;
-    else if (base == 2 && end - pos >= 2 && pos[0] == '0' && (pos[1] == 'b' || pos[1] == 'B'))
-        pos += 2;
+template <size_t Limbs, typename Lanes>
+GINT_FORCE_INLINE Lanes column_equal_rows(const uint64_t * const * lhs, const uint64_t * const * rhs, size_t row) noexcept
+{
+    Lanes difference = Lanes();
+    for (size_t limb = 0; limb < Limbs; ++limb)
+        difference |= column_load<Lanes>(lhs[limb] + row) ^ column_load<Lanes>(rhs[limb] + row);
+    return column_same(difference, Lanes());
 }
 
-inline char format_digit(unsigned digit, bool uppercase) noexcept
+template <typename Lanes>
+GINT_FORCE_INLINE void column_store_mask(unsigned char * out, const Lanes & mask) noexcept
 {
-    return static_cast<char>((digit < 10) ? ('0' + digit) : ((uppercase ? 'A' : 'a') + (digit - 10)));
+    uint64_t words[sizeof(Lanes) / 8];
+    std::memcpy(words, &mask, sizeof(mask));
+    for (size_t i = 0; i < sizeof(Lanes) / 8; ++i)
+        out[i] = static_cast<unsigned char>(words[i] & 1);
 }
 
-inline size_t stream_prefix_size(const std::string & text) noexcept
+// out = mask ? when_set : when_clear, plane by plane.
+template <size_t Limbs, typename Lanes>
+GINT_FORCE_INLINE void column_select_rows(
+    uint64_t * const * out, const uint64_t * const * when_set, const uint64_t * const * when_clear, const Lanes & mask, size_t row) noexcept
 {
-    if (text.empty())
-        return 0;
-    if (text[0] == '-' || text[0] == '+')
-        return 1;
-    if (text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
-        return 2;
-    return 0;
+    for (size_t limb = 0; limb < Limbs; ++limb)
+    {
+        const Lanes set = column_load<Lanes>(when_set[limb] + row);
+        const Lanes clear = column_load<Lanes>(when_clear[limb] + row);
+        column_store(out[limb] + row, (set & mask) | (clear & ~mask));
+    }
 }
 
-inline std::ostream & write_formatted_string(std::ostream & out, const std::string & text)
+template <bool Subtract, size_t Bits, typename Signed>
+inline void column_add_sub(column<Bits, Signed> & values, const column<Bits, Signed> & other) noexcept
 {
-    const std::streamsize width = out.width(0);
-    const std::streamsize size = static_cast<std::streamsize>(text.size());
-    if (width <= size)
-        return out.write(text.data(), size);
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    const auto out = column_planes(values);
+    const auto r = column_planes(other);
+    const size_t rows = values.size();
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    for (; i + column_lane_rows <= rows; i += column_lane_rows)
+        column_add_sub_rows<limbs, Subtract, column_lanes>(out.data(), r.data(), i);
+#    endif
+    for (; i < rows; ++i)
+        column_add_sub_rows<limbs, Subtract, uint64_t>(out.data(), r.data(), i);
+}
 
-    const std::streamsize padding = width - size;
-    const char fill = out.fill();
-    const std::ios_base::fmtflags adjust = out.flags() & std::ios_base::adjustfield;
-    const size_t prefix = (adjust == std::ios_base::internal) ? stream_prefix_size(text) : 0;
+template <size_t Bits, typename Signed>
+inline void column_equal_mask(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs, unsigned char * out) noexcept
+{
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    const auto l = column_planes(lhs);
+    const auto r = column_planes(rhs);
+    const size_t rows = lhs.size();
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    for (; i + column_lane_rows <= rows; i += column_lane_rows)
+        column_store_mask(out + i, column_equal_rows<limbs, column_lanes>(l.data(), r.data(), i));
+#    endif
+    for (; i < rows; ++i)
+        out[i] = static_cast<unsigned char>(column_equal_rows<limbs, uint64_t>(l.data(), r.data(), i) & 1);
+}
 
-    if (adjust == std::ios_base::left)
+template <size_t Bits, typename Signed>
+inline void column_less_mask(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs, unsigned char * out) noexcept
+{
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    constexpr bool is_signed = std::is_same<Signed, signed>::value;
+    const auto l = column_planes(lhs);
+    const auto r = column_planes(rhs);
+    const size_t rows = lhs.size();
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    for (; i + column_lane_rows <= rows; i += column_lane_rows)
+        column_store_mask(out + i, column_less_rows<limbs, is_signed, column_lanes>(l.data(), r.data(), i));
+#    endif
+    for (; i < rows; ++i)
+        out[i] = static_cast<unsigned char>(column_less_rows<limbs, is_signed, uint64_t>(l.data(), r.data(), i) & 1);
+}
+
+// Row-wise minimum, or maximum when take_rhs_when_less is set.
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> column_select_less(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs, bool take_rhs_when_less)
+{
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    constexpr bool is_signed = std::is_same<Signed, signed>::value;
+    column<Bits, Signed> result(lhs.size());
+    const auto out = column_planes(result);
+    const auto l = column_planes(lhs);
+    const auto r = column_planes(rhs);
+    const uint64_t * const * set = take_rhs_when_less ? r.data() : l.data();
+    const uint64_t * const * clear = take_rhs_when_less ? l.data() : r.data();
+    const size_t rows = lhs.size();
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    for (; i + column_lane_rows <= rows; i += column_lane_rows)
+    {
+        const column_lanes less = column_less_rows<limbs, is_signed, column_lanes>(l.data(), r.data(), i);
+        column_select_rows<limbs>(out.data(), set, clear, less, i);
+    }
+#    endif
+    for (; i < rows; ++i)
     {
-        out.write(text.data(), size);
-        for (std::streamsize i = 0; i < padding; ++i)
-            out.put(fill);
-        return out;
+        const uint64_t less = column_less_rows<limbs, is_signed, uint64_t>(l.data(), r.data(), i);
+        column_select_rows<limbs>(out.data(), set, clear, less, i);
     }
+    return result;
+}
 
-    if (prefix)
-        out.write(text.data(), static_cast<std::streamsize>(prefix));
-    for (std::streamsize i = 0; i < padding; ++i)
-        out.put(fill);
-    out.write(text.data() + prefix, size - static_cast<std::streamsize>(prefix));
-    return out;
+// Sum one limb plane into low/carries, as reduce_sum does per limb. Several
+// independent partial sums, vector lanes or four scalars, hide the add latency.
+inline void column_plane_sum(const uint64_t * plane, size_t rows, uint64_t & low, uint64_t & carries) noexcept
+{
+#    if GINT_DETAIL_COLUMN_LANES
+    constexpr size_t lane_rows = sizeof(column_lanes) / 8;
+#    else
+    constexpr size_t lane_rows = 4;
+#    endif
+    uint64_t lows[lane_rows] = {};
+    uint64_t wraps[lane_rows] = {};
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    column_lanes lane_low = column_lanes();
+    column_lanes lane_wraps = column_lanes();
+    for (; i + lane_rows <= rows; i += lane_rows)
+    {
+        const column_lanes x = column_load<column_lanes>(plane + i);
+        lane_low += x;
+        lane_wraps -= column_below(lane_low, x);
+    }
+    column_store(lows, lane_low);
+    column_store(wraps, lane_wraps);
+#    else
+    for (; i + lane_rows <= rows; i += lane_rows)
+    {
+        for (size_t lane = 0; lane < lane_rows; ++lane)
+        {
+            lows[lane] += plane[i + lane];
+            wraps[lane] += static_cast<uint64_t>(lows[lane] < plane[i + lane]);
+        }
+    }
+#    endif
+    uint64_t sum = 0;
+    uint64_t wrapped = 0;
+    for (size_t lane = 0; lane < lane_rows; ++lane)
+    {
+        sum += lows[lane];
+        wrapped += wraps[lane] + static_cast<uint64_t>(sum < lows[lane]);
+    }
+    for (; i < rows; ++i)
+    {
+        sum += plane[i];
+        wrapped += static_cast<uint64_t>(sum < plane[i]);
+    }
+    low = sum;
+    carries = wrapped;
 }
 
-template <size_t Bits, typename Signed>
-inline std::string to_base_string(const integer<Bits, Signed> & value, unsigned base, bool uppercase)
+template <size_t Limbs, bool IsSigned, typename Lanes>
+GINT_FORCE_INLINE Lanes column_less_lanes(const Lanes * lhs, const Lanes * rhs) noexcept
 {
-    if (base == 10)
-        return to_string(value);
+    Lanes less = Lanes();
+    for (size_t limb = 0; limb < Limbs; ++limb)
+    {
+        const Lanes flip = Lanes() + (IsSigned && limb + 1 == Limbs ? uint64_t(1) << 63 : 0);
+        const Lanes x = lhs[limb] ^ flip;
+        const Lanes y = rhs[limb] ^ flip;
+        less = column_below(x, y) | (column_same(x, y) & less);
+    }
+    return less;
+}
 
-    const unsigned bits_per_digit = (base == 16) ? 4 : (base == 8) ? 3 : 1;
-    const unsigned mask = (1u << bits_per_digit) - 1u;
-    const size_t digit_count = (Bits + bits_per_digit - 1) / bits_per_digit;
-    std::string out;
-    out.reserve(digit_count);
+// Keep a running extreme per lane without branches, then fold the lanes into
+// `best`. Returns the number of rows consumed.
+template <bool Maximum, typename Lanes, typename Integer, size_t Limbs = Integer::limbs>
+GINT_FORCE_INLINE size_t column_plane_extreme(const std::array<const uint64_t *, Limbs> & planes, size_t rows, Integer & best) noexcept
+{
+    constexpr size_t lane_rows = sizeof(Lanes) / 8;
+    constexpr bool IsSigned = std::numeric_limits<Integer>::is_signed;
+    Lanes lane_best[Limbs];
+    for (size_t limb = 0; limb < Limbs; ++limb)
+        lane_best[limb] = Lanes() + limb_access::data(best)[limb];
+    size_t i = 0;
+    for (; i + lane_rows <= rows; i += lane_rows)
+    {
+        Lanes x[Limbs];
+        for (size_t limb = 0; limb < Limbs; ++limb)
+            x[limb] = column_load<Lanes>(planes[limb] + i);
+        const Lanes take = Maximum ? column_less_lanes<Limbs, IsSigned>(lane_best, x) : column_less_lanes<Limbs, IsSigned>(x, lane_best);
+        for (size_t limb = 0; limb < Limbs; ++limb)
+            lane_best[limb] = (x[limb] & take) | (lane_best[limb] & ~take);
+    }
+    uint64_t lanes[Limbs][lane_rows];
+    for (size_t limb = 0; limb < Limbs; ++limb)
+        column_store(lanes[limb], lane_best[limb]);
+    for (size_t lane = 0; lane < lane_rows; ++lane)
+    {
+        Integer value;
+        for (size_t limb = 0; limb < Limbs; ++limb)
+            limb_access::data(value)[limb] = lanes[limb][lane];
+        column_keep_extreme<Maximum>(best, value);
+    }
+    return i;
+}
 
-    bool seen = false;
-    for (size_t digit_index = digit_count; digit_index-- > 0;)
+template <bool Maximum, size_t Bits, typename Signed>
+inline void column_reduce_extreme(const column<Bits, Signed> & values, integer<Bits, Signed> & out) noexcept
+{
+    const auto planes = column_planes(values);
+    size_t i = 0;
+#    if GINT_DETAIL_COLUMN_LANES
+    i = column_plane_extreme<Maximum, column_lanes>(planes, values.size(), out);
+#    endif
+    if (i == values.size())
+        return;
+    // Remaining rows: track the extreme's row index, as reduce_min tracks an
+    // address, comparing from the top plane down.
+    size_t best = i;
+    for (size_t row = i + 1; row < values.size(); ++row)
     {
-        const size_t bit = digit_index * bits_per_digit;
-        const size_t limb_index = bit / 64;
-        const unsigned shift = static_cast<unsigned>(bit % 64);
-        unsigned digit = static_cast<unsigned>((value.data_[limb_index] >> shift) & mask);
-        if (shift + bits_per_digit > 64 && limb_index + 1 < integer<Bits, Signed>::limbs)
-            digit |= static_cast<unsigned>(value.data_[limb_index + 1] << (64 - shift)) & mask;
+        const bool take = Maximum ? column_row_less<Signed>(planes, best, row) : column_row_less<Signed>(planes, row, best);
+        best = take ? row : best;
+    }
+    column_keep_extreme<Maximum>(out, values[best]);
+}
+} // namespace GINT_DETAIL_COLUMN_LANE_NAMESPACE
+} // namespace detail
+
+inline namespace GINT_DETAIL_COLUMN_LANE_NAMESPACE
+{
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> & operator+=(column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs) noexcept
+{
+    detail::column_add_sub<false>(lhs, rhs);
+    return lhs;
+}
+
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> & operator-=(column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs) noexcept
+{
+    detail::column_add_sub<true>(lhs, rhs);
+    return lhs;
+}
 
-        const unsigned valid_bits = static_cast<unsigned>((Bits - bit < bits_per_digit) ? (Bits - bit) : bits_per_digit);
-        digit &= (1u << valid_bits) - 1u;
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> operator+(column<Bits, Signed> lhs, const column<Bits, Signed> & rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
 
-        if (digit || seen)
-        {
-            out.push_back(format_digit(digit, uppercase));
-            seen = true;
-        }
-    }
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> operator-(column<Bits, Signed> lhs, const column<Bits, Signed> & rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
 
-    return seen ? out : std::string("0");
+/// `out[i]` is 1 when row `i` of `lhs` equals row `i` of `rhs`, else 0.
+template <size_t Bits, typename Signed>
+inline void equal_mask(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs, unsigned char * out) noexcept
+{
+    detail::column_equal_mask(lhs, rhs, out);
 }
 
+/// `out[i]` is 1 when row `i` of `lhs` is less than row `i` of `rhs`, else 0.
 template <size_t Bits, typename Signed>
-inline std::string format_stream_value(const integer<Bits, Signed> & value, const std::ios_base::fmtflags flags)
+inline void less_mask(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs, unsigned char * out) noexcept
 {
-    const std::ios_base::fmtflags basefield = flags & std::ios_base::basefield;
-    const bool uppercase = (flags & std::ios_base::uppercase) != 0;
-    unsigned base = 10;
-    if (basefield == std::ios_base::hex)
-        base = 16;
-    else if (basefield == std::ios_base::oct)
-        base = 8;
+    detail::column_less_mask(lhs, rhs, out);
+}
 
-    std::string text = to_base_string(value, base, uppercase);
-    if (base == 10)
-    {
-        if ((flags & std::ios_base::showpos) && (text.empty() || text[0] != '-'))
-            text.insert(text.begin(), '+');
-        return text;
-    }
+/// Row-wise minimum.
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> min(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs)
+{
+    return detail::column_select_less(lhs, rhs, false);
+}
 
-    if ((flags & std::ios_base::showbase) && text != "0")
-    {
-        if (base == 16)
-            text.insert(0, uppercase ? "0X" : "0x");
-        else if (base == 8 && text[0] != '0')
-            text.insert(text.begin(), '0');
-    }
-    return text;
+/// Row-wise maximum.
+template <size_t Bits, typename Signed>
+inline column<Bits, Signed> max(const column<Bits, Signed> & lhs, const column<Bits, Signed> & rhs)
+{
+    return detail::column_select_less(lhs, rhs, true);
 }
 
-template <unsigned BitsPerDigit, size_t Bits, typename Signed>
-GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range(const char * begin, const char * end)
+/// Column form of `reduce_sum`: each limb plane is summed across rows in
+/// vector lanes.
+template <size_t Bits, typename Signed>
+inline void reduce_sum(const column<Bits, Signed> & values, integer<Bits + 64, Signed> & out) noexcept
 {
-    using Int = integer<Bits, Signed>;
-    using limb_type = typename Int::limb_type;
-    const unsigned base = 1u << BitsPerDigit;
-    const size_t chunk_digits = 64u / BitsPerDigit;
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    uint64_t low[limbs];
+    uint64_t carries[limbs];
+    for (size_t limb = 0; limb < limbs; ++limb)
+        detail::column_plane_sum(values.plane(limb), values.size(), low[limb], carries[limb]);
+    uint64_t negatives = 0;
+    if (std::is_same<Signed, signed>::value)
+    {
+        const uint64_t * top = values.plane(limbs - 1);
+        for (size_t i = 0; i < values.size(); ++i)
+            negatives += top[i] >> 63;
+    }
+    detail::add_limb_sums<Bits>(out, low, carries, negatives);
+}
 
-    Int result;
-    const char * cursor = begin;
-    size_t digits_left = static_cast<size_t>(end - begin);
-    size_t current_chunk_digits = digits_left % chunk_digits;
-    if (current_chunk_digits == 0)
-        current_chunk_digits = chunk_digits;
-    bool first_chunk = true;
+/// Column form of `reduce_min`.
+template <size_t Bits, typename Signed>
+inline void reduce_min(const column<Bits, Signed> & values, integer<Bits, Signed> & out) noexcept
+{
+    detail::column_reduce_extreme<false>(values, out);
+}
 
-    while (digits_left != 0)
-    {
-        limb_type chunk = 0;
-        for (size_t i = 0; i < current_chunk_digits; ++i)
-        {
-            const unsigned value = static_cast<unsigned>(static_cast<unsigned char>(*cursor++));
-            const unsigned digit = BitsPerDigit == 4u ? hexadecimal_digit_value(value) : value - static_cast<unsigned>('0');
-            if (digit >= base)
-                GINT_THROW(std::invalid_argument("gint::from_string invalid digit"));
-            chunk = (chunk << BitsPerDigit) | digit;
-        }
+/// Column form of `reduce_max`.
+template <size_t Bits, typename Signed>
+inline void reduce_max(const column<Bits, Signed> & values, integer<Bits, Signed> & out) noexcept
+{
+    detail::column_reduce_extreme<true>(values, out);
+}
 
-        digits_left -= current_chunk_digits;
-        if (Int::limbs <= 4)
-        {
-            if (first_chunk)
-            {
-                result.data_[0] = chunk;
-                first_chunk = false;
-            }
-            else
-            {
-                const unsigned shift = static_cast<unsigned>(current_chunk_digits * BitsPerDigit);
-                if (shift == 64u)
-                {
-                    for (size_t i = Int::limbs; i-- > 1;)
-                        result.data_[i] = result.data_[i - 1];
-                    result.data_[0] = chunk;
-                }
-                else
-                {
-                    const unsigned inv_shift = 64u - shift;
-                    for (size_t i = Int::limbs; i-- > 1;)
-                        result.data_[i] = (result.data_[i] << shift) | (result.data_[i - 1] >> inv_shift);
-                    result.data_[0] = (result.data_[0] << shift) | chunk;
-                }
-            }
-        }
-        else if (digits_left <= Bits / BitsPerDigit)
-        {
-            const size_t bit_offset = digits_left * BitsPerDigit;
-            if (bit_offset < Bits)
-            {
-                const size_t limb_index = bit_offset / 64u;
-                const unsigned shift = static_cast<unsigned>(bit_offset % 64u);
-                result.data_[limb_index] |= chunk << shift;
-                if (shift && limb_index + 1 < Int::limbs)
-                    result.data_[limb_index + 1] |= chunk >> (64u - shift);
-            }
-        }
-        current_chunk_digits = chunk_digits;
-    }
+/// Column form of `reduce_avg`.
+template <size_t Bits, typename Signed>
+inline divmod_result<integer<Bits, Signed>> reduce_avg(const column<Bits, Signed> & values)
+{
+    integer<Bits + 64, Signed> sum = 0;
+    reduce_sum(values, sum);
+    const divmod_result<integer<Bits + 64, Signed>> wide = divmod(sum, integer<Bits + 64, Signed>(values.size()));
+    const divmod_result<integer<Bits, Signed>> result = {integer<Bits, Signed>(wide.quotient), integer<Bits, Signed>(wide.remainder)};
     return result;
 }
+} // namespace GINT_DETAIL_COLUMN_LANE_NAMESPACE
 
-template <unsigned BitsPerDigit, size_t Bits, typename Signed>
-GINT_WIDE_PARSE_INLINE integer<Bits, Signed> parse_wide_power_of_two_range(const char * begin, const char * end)
+namespace detail
 {
-    // GCC/x86 is sensitive to the layout of this large parser when it is
-    // merged into parse_string_range. Keep wide power-of-two parsing in its
-    // own code-generation unit; other compiler/architecture pairs inline it.
-    return parse_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+// Row-serial scan over the planes. Rows depend on each other only through
+// the running sum, whose carry chain pipelines across rows, so there is no
+// lane parallelism to add; the planes are read and written in place of rows.
+template <bool Inclusive, size_t Bits, typename Signed>
+inline void column_scan(const column<Bits, Signed> & values, column<Bits, Signed> & out, const integer<Bits, Signed> & init)
+{
+    constexpr size_t limbs = column<Bits, Signed>::limbs;
+    const size_t rows = values.size();
+    out.resize(rows);
+    const uint64_t * source[limbs];
+    uint64_t * target[limbs];
+    for (size_t limb = 0; limb < limbs; ++limb)
+    {
+        source[limb] = values.plane(limb);
+        target[limb] = out.plane(limb);
+    }
+    integer<Bits, Signed> sum = init;
+    for (size_t row = 0; row < rows; ++row)
+    {
+        integer<Bits, Signed> next;
+        uint64_t * next_limbs = limb_access::data(next);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            next_limbs[limb] = source[limb][row];
+        const integer<Bits, Signed> before = sum;
+        sum = scan_add(sum, next);
+        const uint64_t * written = limb_access::data(Inclusive ? sum : before);
+        for (size_t limb = 0; limb < limbs; ++limb)
+            target[limb][row] = written[limb];
+    }
 }
+} // namespace detail
 
-template <unsigned BitsPerDigit, size_t Bits, typename Signed>
-GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range_selected(const char * begin, const char * end, std::false_type)
+/// Column form of `inclusive_scan`; `out` is resized to `values.size()` and
+/// may be `values` itself.
+template <size_t Bits, typename Signed>
+inline void inclusive_scan(const column<Bits, Signed> & values, column<Bits, Signed> & out, const integer<Bits, Signed> & init = 0)
 {
-    return parse_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+    detail::column_scan<true>(values, out, init);
 }
 
-template <unsigned BitsPerDigit, size_t Bits, typename Signed>
-GINT_FORCE_INLINE integer<Bits, Signed> parse_power_of_two_range_selected(const char * begin, const char * end, std::true_type)
+/// Column form of `exclusive_scan`; `out` is resized to `values.size()` and
+/// may be `values` itself.
+template <size_t Bits, typename Signed>
+inline void exclusive_scan(const column<Bits, Signed> & values, column<Bits, Signed> & out, const integer<Bits, Signed> & init = 0)
 {
-    return parse_wide_power_of_two_range<BitsPerDigit, Bits, Signed>(begin, end);
+    detail::column_scan<false>(values, out, init);
 }
 
+#    undef GINT_DETAIL_COLUMN_LANES
+#    undef GINT_DETAIL_COLUMN_LANE_NAMESPACE
+
+//=== Bucketizer =============================================================
+
+template <typename Integer>
+class bucketizer;
+
+/// Sorted boundaries laid out for bucket lookup: `lookup(value)` returns how
+/// many boundaries are `<= value`, the same index as `std::upper_bound`, so
+/// value `v` falls in bucket `i` when `boundaries[i - 1] <= v < boundaries[i]`.
+///
+/// Boundaries are stored in Eytzinger (breadth-first) order, padded to a full
+/// tree so every lookup takes the same number of steps. Limbs shared by all
+/// boundaries are compared once up front; the tree itself holds only the
+/// highest limb on which the boundaries differ, with full values consulted
+/// only when that limb ties. The batch `lookup` walks several values through
+/// the tree in lockstep so their cache misses overlap.
 template <size_t Bits, typename Signed>
-inline integer<Bits, Signed> parse_string_range(const char * begin, const char * end, unsigned base)
+class bucketizer<integer<Bits, Signed>>
 {
-    if (begin == end)
-        GINT_THROW(std::invalid_argument("gint::from_string empty string"));
+public:
+    using value_type = integer<Bits, Signed>;
+    static constexpr size_t limbs = value_type::limbs;
 
-    const char * pos = begin;
-    bool negative = false;
-    if (*pos == '+' || *pos == '-')
+    bucketizer() = default;
+
+    /// `boundaries[0, count)` must be sorted in non-decreasing order.
+    bucketizer(const value_type * boundaries, size_t count) : count_(count)
     {
-        negative = *pos == '-';
-        ++pos;
-        if (pos == end)
-            GINT_THROW(std::invalid_argument("gint::from_string sign without digits"));
+        if (count == 0)
+            return;
+        const key_type first = order_key(boundaries[0]);
+        const key_type last = order_key(boundaries[count - 1]);
+        const uint64_t * low = detail::limb_access::data(first);
+        const uint64_t * high = detail::limb_access::data(last);
+        split_ = limbs - 1;
+        while (split_ > 0 && low[split_] == high[split_])
+            --split_;
+        prefix_ = first;
+        while ((size_t(1) << depth_) <= count)
+            ++depth_;
+        // Padding nodes sort after every boundary and never tie below it.
+        const size_t nodes = size_t(1) << depth_;
+        keys_.assign(nodes, ~uint64_t(0));
+        nodes_.assign(nodes, ~key_type(0));
+        for (size_t node = 1; node < nodes; ++node)
+        {
+            const size_t index = rank(node);
+            if (index >= count)
+                continue;
+            nodes_[node] = order_key(boundaries[index]);
+            keys_[node] = detail::limb_access::data(nodes_[node])[split_];
+        }
     }
 
-    detect_parse_base(end, pos, base);
-    if (pos == end)
-        GINT_THROW(std::invalid_argument("gint::from_string prefix without digits"));
+    /// Number of boundaries.
+    size_t size() const noexcept { return count_; }
 
-    using Int = integer<Bits, Signed>;
-    using limb_type = typename Int::limb_type;
+    bool empty() const noexcept { return count_ == 0; }
 
-    // Fixed-width parsing of power-of-two bases is pure bit packing. Work from
-    // 64-bit digit chunks and place them directly into the destination limbs,
-    // so over-width input naturally wraps modulo 2^Bits.
-    if (base == 2)
+    /// Number of boundaries `<= value`.
+    size_t lookup(const value_type & value) const noexcept
     {
-        Int result = parse_power_of_two_range_selected<1, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
-        return negative ? -result : result;
+        size_t node = 1;
+        const key_type key = order_key(value);
+        const int side = compare_prefix(key);
+        if (side != 0)
+            return side < 0 ? 0 : count_;
+        const uint64_t top = detail::limb_access::data(key)[split_];
+        for (size_t level = 0; level < depth_; ++level)
+            node = 2 * node + go_right(key, top, node);
+        return result(node);
     }
-    if (base == 8)
+
+    /// `out[i] = lookup(values[i])` for i in [0, count).
+    void lookup(const value_type * values, size_t count, size_t * out) const noexcept
     {
-        Int result = parse_power_of_two_range_selected<3, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
-        return negative ? -result : result;
+        size_t i = 0;
+        if (count_ != 0)
+        {
+            for (; i + group <= count; i += group)
+                lookup_group(values + i, out + i);
+        }
+        for (; i < count; ++i)
+            out[i] = lookup(values[i]);
     }
-    if (base == 16)
+
+private:
+    using key_type = integer<Bits, unsigned>;
+    static constexpr size_t group = 8;
+
+    // Unsigned image with the same order as `value_type`.
+    static key_type order_key(const value_type & value) noexcept
     {
-        Int result = parse_power_of_two_range_selected<4, Bits, Signed>(pos, end, std::integral_constant<bool, (Int::limbs > 4)>());
-        return negative ? -result : result;
+        key_type key(value);
+        if (std::is_same<Signed, signed>::value)
+            detail::limb_access::data(key)[limbs - 1] ^= uint64_t(1) << 63;
+        return key;
     }
 
-    const limb_type max_limb = std::numeric_limits<limb_type>::max();
-    limb_type chunk_base = 1;
-    size_t chunk_digits = 0;
-    while (chunk_base <= max_limb / base)
+    // Compare the limbs above split_ with the boundaries' common prefix.
+    int compare_prefix(const key_type & key) const noexcept
     {
-        chunk_base *= base;
-        ++chunk_digits;
+        const uint64_t * x = detail::limb_access::data(key);
+        const uint64_t * p = detail::limb_access::data(prefix_);
+        for (size_t limb = limbs - 1; limb > split_; --limb)
+        {
+            if (x[limb] != p[limb])
+                return x[limb] < p[limb] ? -1 : 1;
+        }
+        return 0;
     }
 
-    Int result;
-    bool first_chunk = true;
-    size_t digits_left = static_cast<size_t>(end - pos);
-    size_t current_chunk_digits = digits_left % chunk_digits;
-    if (current_chunk_digits == 0)
-        current_chunk_digits = chunk_digits;
-
-    while (digits_left != 0)
+    // Whether `node <= key`, i.e. the search continues right.
+    GINT_FORCE_INLINE bool go_right(const key_type & key, uint64_t top, size_t node) const noexcept
     {
-        limb_type chunk = 0;
-        for (size_t i = 0; i < current_chunk_digits; ++i, ++pos)
+        const uint64_t boundary = keys_[node];
+        if (top != boundary)
+            return top > boundary;
+        const uint64_t * x = detail::limb_access::data(key);
+        const uint64_t * b = detail::limb_access::data(nodes_[node]);
+        for (size_t limb = split_; limb-- > 0;)
         {
-            const unsigned digit = string_digit_value(*pos);
-            if (digit >= base)
-                GINT_THROW(std::invalid_argument("gint::from_string invalid digit"));
-            chunk = chunk * base + digit;
+            if (x[limb] != b[limb])
+                return x[limb] > b[limb];
         }
-        if (first_chunk)
+        return true;
+    }
+
+    // Sorted position of a tree node: node k on level l is the
+    // (2 * (k - 2^l) + 1)-th of 2^(l + 1) equal slices of the in-order sequence.
+    size_t rank(size_t node) const noexcept
+    {
+        const size_t level = static_cast<size_t>(63 - __builtin_clzll(node));
+        return ((2 * (node - (size_t(1) << level)) + 1) << (depth_ - 1 - level)) - 1;
+    }
+
+    // After depth_ steps the path ends below a leaf; the answer is the last
+    // node where it turned left (strip the trailing right turns and one left).
+    size_t result(size_t node) const noexcept
+    {
+        node >>= __builtin_ctzll(~static_cast<unsigned long long>(node)) + 1;
+        const size_t index = node == 0 ? count_ : rank(node);
+        return index < count_ ? index : count_;
+    }
+
+    void lookup_group(const value_type * values, size_t * out) const noexcept
+    {
+        key_type keys[group];
+        uint64_t tops[group];
+        size_t nodes[group];
+        int sides[group];
+        for (size_t j = 0; j < group; ++j)
         {
-            result = chunk;
-            first_chunk = false;
+            keys[j] = order_key(values[j]);
+            sides[j] = compare_prefix(keys[j]);
+            tops[j] = detail::limb_access::data(keys[j])[split_];
+            nodes[j] = 1;
         }
-        else
+        for (size_t level = 0; level < depth_; ++level)
         {
-            result.mul_add_limb(chunk_base, chunk);
+            for (size_t j = 0; j < group; ++j)
+                nodes[j] = 2 * nodes[j] + go_right(keys[j], tops[j], nodes[j]);
         }
-        digits_left -= current_chunk_digits;
-        current_chunk_digits = chunk_digits;
+        for (size_t j = 0; j < group; ++j)
+            out[j] = sides[j] < 0 ? 0 : sides[j] > 0 ? count_ : result(nodes[j]);
     }
 
-    return negative ? -result : result;
-}
-} // namespace detail
-
-template <size_t Bits, typename Signed>
-inline integer<Bits, Signed> from_string(const std::string & text, unsigned base)
-{
-    return detail::parse_string_range<Bits, Signed>(text.data(), text.data() + text.size(), base);
-}
+    size_t count_ = 0;
+    size_t depth_ = 0;
+    size_t split_ = 0;
+    key_type prefix_ = 0;
+    std::vector<uint64_t> keys_;
+    std::vector<key_type> nodes_;
+};
 
+#    if __cplusplus < 201703L
 template <size_t Bits, typename Signed>
-inline integer<Bits, Signed> from_string(const char * text, unsigned base)
-{
-    if (!text)
-        GINT_THROW(std::invalid_argument("gint::from_string null string"));
-    return detail::parse_string_range<Bits, Signed>(text, text + std::strlen(text), base);
-}
-
-template <typename Int>
-inline Int from_string(const std::string & text, unsigned base)
-{
-    return from_string<Int::bits, typename Int::signed_tag>(text, base);
-}
-
-template <typename Int>
-inline Int from_string(const char * text, unsigned base)
-{
-    return from_string<Int::bits, typename Int::signed_tag>(text, base);
-}
-
+constexpr size_t bucketizer<integer<Bits, Signed>>::limbs;
 template <size_t Bits, typename Signed>
-inline std::ostream & operator<<(std::ostream & out, const integer<Bits, Signed> & value)
-{
-    const std::string text = detail::format_stream_value(value, out.flags());
-    return detail::write_formatted_string(out, text);
-} // LCOV_EXCL_LINE
+constexpr size_t bucketizer<integer<Bits, Signed>>::group;
+#    endif
 
 } // namespace GINT_DETAIL_CONFIG_NAMESPACE
 } // namespace gint
@@ -6325,6 +9945,9 @@ struct formatter<gint::integer<Bits, Signed>>
 #    undef GINT_THROW
 #    undef GINT_DETAIL_EXCEPTIONS_ENABLED
 #    undef GINT_DETAIL_DIVZERO_CHECKS
+#    undef GINT_DETAIL_DIVISION_CACHE
+#    undef GINT_DETAIL_PATH_STATS
+#    undef GINT_COUNT_PATH
 #    undef GINT_ZERO_CHECK
 #    undef GINT_DIVZERO_CHECK
 #    undef GINT_MODZERO_CHECK
@@ -0,0 +1,243 @@
+#pragma once
+
+// Multi-threaded bulk operations over arrays of gint::integer. Optional: it
+// needs only <thread> beyond <gint/gint.h>, but users must link the platform
+// thread library (e.g. CMake Threads::Threads).
+//
+// Every function splits the range into fixed-size chunks that worker threads
+// claim from a shared counter, so a thread that finishes early keeps taking
+// chunks from the ones still busy. Results are bit-identical to the serial
+// operation for any thread count: element-wise operations write disjoint
+// outputs, the sum is exact, and scans rely only on modular addition being
+// associative.
+
+#include <gint/gint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace gint
+{
+namespace parallel
+{
+namespace detail
+{
+// Elements per chunk: 64 KiB of input keeps the shared counter off the hot
+// path while leaving enough chunks to balance uneven threads.
+template <typename T>
+constexpr size_t chunk_elements() noexcept
+{
+    return sizeof(T) < (size_t(1) << 16) ? (size_t(1) << 16) / sizeof(T) : 1;
+}
+
+inline unsigned thread_count(unsigned threads) noexcept
+{
+    if (threads != 0)
+        return threads;
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware != 0 ? hardware : 1;
+}
+
+// Run body(worker, begin, end) over [0, count) in chunks of `chunk` elements
+// on up to `threads` threads, the calling thread included. `worker` is below
+// the number of threads used and identifies per-thread state.
+template <typename Body>
+void for_each_chunk(size_t count, size_t chunk, unsigned threads, Body body)
+{
+    const size_t chunks = (count + chunk - 1) / chunk;
+    const unsigned workers = static_cast<unsigned>(std::min<size_t>(thread_count(threads), chunks));
+    if (workers <= 1)
+    {
+        if (count != 0)
+            body(0u, size_t(0), count);
+        return;
+    }
+    std::atomic<size_t> next(0);
+    auto work = [&](unsigned worker)
+    {
+        for (size_t index = next.fetch_add(1, std::memory_order_relaxed); index < chunks;
+             index = next.fetch_add(1, std::memory_order_relaxed))
+            body(worker, index * chunk, std::min(count, (index + 1) * chunk));
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (unsigned worker = 1; worker < workers; ++worker)
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+        // Fewer threads only means fewer chunk takers; the caller finishes the rest.
+        try
+        {
+            pool.emplace_back(work, worker);
+        }
+        catch (...)
+        {
+            break;
+        }
+#else
+        pool.emplace_back(work, worker);
+#endif
+    }
+    work(0u);
+    for (std::thread & thread : pool)
+        thread.join();
+}
+} // namespace detail
+
+/// Threaded `gint::reduce_sum`: add the sum of `values[0, count)` to `out`.
+/// `threads` of 0 uses `std::thread::hardware_concurrency()`.
+template <size_t Bits, typename Signed>
+void reduce_sum(const integer<Bits, Signed> * values, size_t count, integer<Bits + 64, Signed> & out, unsigned threads = 0)
+{
+    const unsigned workers = detail::thread_count(threads);
+    std::vector<accumulator<Bits, Signed>> sums(workers);
+    detail::for_each_chunk(
+        count,
+        detail::chunk_elements<integer<Bits, Signed>>(),
+        workers,
+        [&](unsigned worker, size_t begin, size_t end)
+        {
+            accumulator<Bits, Signed> sum = sums[worker];
+            for (size_t i = begin; i < end; ++i)
+                sum += values[i];
+            sums[worker] = sum;
+        });
+    for (size_t worker = 1; worker < sums.size(); ++worker)
+        sums[0] += sums[worker];
+    out += sums[0].value();
+}
+
+/// `out[i] = values[i] * factor` for i in [0, count), wrapping like `*`.
+/// `out` may equal `values`.
+template <size_t Bits, typename Signed>
+void transform_mul_scalar(
+    const integer<Bits, Signed> * values, size_t count, const integer<Bits, Signed> & factor, integer<Bits, Signed> * out, unsigned threads = 0)
+{
+    detail::for_each_chunk(
+        count,
+        detail::chunk_elements<integer<Bits, Signed>>(),
+        threads,
+        [&](unsigned, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                out[i] = values[i] * factor;
+        });
+}
+
+/// `out[i] = values[i] / divisor` for i in [0, count). `out` may equal
+/// `values`. A zero divisor takes the serial path, so it fails exactly as `/`
+/// does under the active configuration.
+template <size_t Bits, typename Signed>
+void divide_all_by(
+    const integer<Bits, Signed> * values, size_t count, const integer<Bits, Signed> & divisor, integer<Bits, Signed> * out, unsigned threads = 0)
+{
+    if (divisor == 0)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = values[i] / divisor;
+        return;
+    }
+    detail::for_each_chunk(
+        count,
+        detail::chunk_elements<integer<Bits, Signed>>(),
+        threads,
+        [&](unsigned, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                out[i] = values[i] / divisor;
+        });
+}
+
+namespace detail
+{
+// Two passes over the chunks: sum each chunk, scan the chunk sums serially
+// into per-chunk offsets, then scan each chunk from its offset. Modular
+// addition is associative, so the split does not change any output.
+template <bool Inclusive, size_t Bits, typename Signed>
+void scan(
+    const integer<Bits, Signed> * values, size_t count, integer<Bits, Signed> * out, const integer<Bits, Signed> & init, unsigned threads)
+{
+    const size_t chunk = chunk_elements<integer<Bits, Signed>>();
+    const unsigned workers = thread_count(threads);
+    if (workers <= 1 || count <= chunk)
+    {
+        if (Inclusive)
+            gint::inclusive_scan(values, count, out, init);
+        else
+            gint::exclusive_scan(values, count, out, init);
+        return;
+    }
+    std::vector<integer<Bits, Signed>> offsets((count + chunk - 1) / chunk);
+    for_each_chunk(
+        count,
+        chunk,
+        workers,
+        [&](unsigned, size_t begin, size_t end)
+        {
+            integer<Bits, Signed> sum = 0;
+            for (size_t i = begin; i < end; ++i)
+                sum += values[i];
+            offsets[begin / chunk] = sum;
+        });
+    gint::exclusive_scan(offsets.data(), offsets.size(), offsets.data(), init);
+    for_each_chunk(
+        count,
+        chunk,
+        workers,
+        [&](unsigned, size_t begin, size_t end)
+        {
+            if (Inclusive)
+                gint::inclusive_scan(values + begin, end - begin, out + begin, offsets[begin / chunk]);
+            else
+                gint::exclusive_scan(values + begin, end - begin, out + begin, offsets[begin / chunk]);
+        });
+}
+} // namespace detail
+
+/// Threaded `gint::inclusive_scan`. `out` may equal `values`.
+template <size_t Bits, typename Signed>
+void inclusive_scan(
+    const integer<Bits, Signed> * values,
+    size_t count,
+    integer<Bits, Signed> * out,
+    const integer<Bits, Signed> & init = 0,
+    unsigned threads = 0)
+{
+    detail::scan<true>(values, count, out, init, threads);
+}
+
+/// Threaded `gint::exclusive_scan`. `out` may equal `values`.
+template <size_t Bits, typename Signed>
+void exclusive_scan(
+    const integer<Bits, Signed> * values,
+    size_t count,
+    integer<Bits, Signed> * out,
+    const integer<Bits, Signed> & init = 0,
+    unsigned threads = 0)
+{
+    detail::scan<false>(values, count, out, init, threads);
+}
+
+/// `to_chars` of each value into its own `width`-byte slot: value i is written
+/// at `out + i * width` and its result stored in `results[i]`, with the same
+/// meaning as a single `to_chars` call on that slot.
+template <size_t Bits, typename Signed>
+void to_chars_all(
+    const integer<Bits, Signed> * values, size_t count, char * out, size_t width, to_chars_result * results, unsigned threads = 0)
+{
+    detail::for_each_chunk(
+        count,
+        detail::chunk_elements<integer<Bits, Signed>>(),
+        threads,
+        [&](unsigned, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                char * slot = out + i * width;
+                results[i] = to_chars(slot, slot + width, values[i]);
+            }
+        });
+}
+} // namespace parallel
+} // namespace gint
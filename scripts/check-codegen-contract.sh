@@ -36,3 +36,27 @@ python3 scripts/check_codegen_contract.py \
     --compiler "$COMPILER_VERSION" \
     --target "$TARGET" \
     --output "$REPORT"
+
+# Positive control for the forbidden_symbols check: the same probes built with
+# GINT_ENABLE_PATH_STATS must reference the counters.
+"$CXX_BIN" \
+    -std=c++11 \
+    -O3 \
+    -DNDEBUG \
+    -DGINT_ENABLE_PATH_STATS \
+    -Wall \
+    -Wextra \
+    -Werror \
+    -fno-stack-protector \
+    -fno-optimize-sibling-calls \
+    -Iinclude \
+    -S tests/perf/codegen_contract.cpp \
+    -o "$OUTPUT_DIR/codegen_contract_path_stats.s"
+
+python3 scripts/check_codegen_contract.py \
+    --assembly "$OUTPUT_DIR/codegen_contract_path_stats.s" \
+    --contract tests/perf/codegen_contract.json \
+    --compiler "$COMPILER_VERSION" \
+    --target "$TARGET" \
+    --output "$OUTPUT_DIR/codegen_contract_path_stats.json" \
+    --expect-forbidden-symbols
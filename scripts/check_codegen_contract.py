@@ -329,6 +329,37 @@ def evaluate_contract(functions, contract, architecture):
     return results, violations
 
 
+def check_symbol_references(text, substrings, expect_present=False):
+    """Find assembly lines naming any of the substrings.
+
+    By default every reference is a violation. With expect_present, as for a
+    build that enables the counted feature, each substring must appear at
+    least once instead.
+    """
+    references = []
+    for line_number, raw_line in enumerate(text.splitlines(), 1):
+        line = raw_line.strip()
+        for substring in substrings:
+            if substring in line:
+                references.append(
+                    {"line": line_number, "instruction": line, "substring": substring}
+                )
+
+    violations = []
+    for substring in substrings:
+        found = [ref for ref in references if ref["substring"] == substring]
+        if expect_present and not found:
+            violations.append("no reference to {0}".format(substring))
+        if not expect_present:
+            for ref in found:
+                violations.append(
+                    "forbidden symbol {0} at line {1}: {2}".format(
+                        substring, ref["line"], ref["instruction"]
+                    )
+                )
+    return references, violations
+
+
 def parse_args(argv):
     parser = argparse.ArgumentParser(description=__doc__)
     parser.add_argument("--assembly", required=True, help="compiler-generated assembly")
@@ -336,18 +367,34 @@ def parse_args(argv):
     parser.add_argument("--compiler", required=True, help="compiler version string")
     parser.add_argument("--target", required=True, help="compiler target triple")
     parser.add_argument("--output", required=True, help="machine-readable JSON report")
+    parser.add_argument(
+        "--expect-forbidden-symbols",
+        action="store_true",
+        help="require the forbidden symbols and skip the function budgets",
+    )
     return parser.parse_args(argv)
 
 
 def main(argv=None):
     args = parse_args(argv)
     with open(args.assembly, "r") as assembly_file:
-        functions = parse_assembly(assembly_file.read())
+        assembly = assembly_file.read()
     with open(args.contract, "r") as contract_file:
         contract = json.load(contract_file)
 
     architecture = normalize_architecture(args.target)
-    results, violations = evaluate_contract(functions, contract, architecture)
+    if args.expect_forbidden_symbols:
+        results, violations = {}, []
+    else:
+        results, violations = evaluate_contract(
+            parse_assembly(assembly), contract, architecture
+        )
+    references, symbol_violations = check_symbol_references(
+        assembly,
+        contract.get("forbidden_symbols", []),
+        args.expect_forbidden_symbols,
+    )
+    violations.extend(symbol_violations)
     report = {
         "schema_version": 1,
         "status": "fail" if violations else "pass",
@@ -357,6 +404,7 @@ def main(argv=None):
         "target": args.target,
         "assembly": os.path.basename(args.assembly),
         "functions": results,
+        "symbol_references": references,
         "violations": violations,
     }
 
@@ -380,6 +428,7 @@ def main(argv=None):
                 len(result["back_edges"]),
             )
         )
+    print("forbidden symbol references: {0}".format(len(references)))
     if violations:
         for violation in violations:
             print("error: {0}".format(violation), file=sys.stderr)
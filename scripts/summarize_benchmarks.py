@@ -7,11 +7,38 @@ from __future__ import print_function
 import argparse
 import json
 import os
+import re
 import statistics
 import sys
 
 
 NOISY_CV_THRESHOLD = 0.05
+LATENCY_PREFIX = "Latency/"
+NANOSECONDS_PER_UNIT = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+# perf_benchmark_all_widths registers each case as <case>/bits:<N>[/<args>].
+WIDTH_PATTERN = re.compile(r"/bits:(\d+)(?=/|$)")
+BASE_WIDTH = 128
+# Expected exponent of the time growth in the bit width, first match wins;
+# other cases are expected to scale linearly. Full products and multi-limb
+# quotients do work per limb pair, as does decimal conversion, which divides or
+# multiplies by 10^19 once per limb of a value that is itself limbs wide. A
+# single-limb operand, a divisor of similar magnitude (one quotient limb) or a
+# fixed 128-bit divisor (constant work per quotient limb) keeps it linear.
+EXPECTED_SCALING = (
+    (
+        re.compile(
+            r"^(Latency/)?(Mul|Div|Mod|DivMod)/"
+            r"(U64xU64|WideTimesU\d+|SmallDivisor\d+|Pow2Divisor|SimilarMagnitude(\d*|Separate)|LargeDivisor128)\b"
+        ),
+        1.0,
+    ),
+    (re.compile(r"^(Latency/)?(Mul|Div|Mod|DivMod)/"), 2.0),
+    (re.compile(r"^(Latency/)?(ToString|ToChars|FromString|FromStringCStr)/Base10\b"), 2.0),
+)
+# A width is flagged when its time grows this much faster than expected.
+SCALING_TOLERANCE = 0.25
+# User counters written by bench/perf_counters.h under --gint_perf_counters.
+PERF_COUNTERS = ("cycles", "instructions", "IPC", "branch_misses", "l1d_misses")
 
 
 def parse_assignment(value, option):
@@ -23,6 +50,82 @@ def parse_assignment(value, option):
     return name, assigned_value
 
 
+def to_nanoseconds(value, unit):
+    if unit not in NANOSECONDS_PER_UNIT:
+        raise ValueError("unknown benchmark time unit: {0}".format(unit))
+    return value * NANOSECONDS_PER_UNIT[unit]
+
+
+def latency_pairs(medians):
+    """Pair each Latency/<case> median with the throughput median of <case>."""
+    by_name = dict((row["name"], row) for row in medians)
+    pairs = []
+    for row in medians:
+        if not row["name"].startswith(LATENCY_PREFIX):
+            continue
+        throughput = by_name.get(row["name"][len(LATENCY_PREFIX):])
+        if throughput is None:
+            continue
+        throughput_ns = to_nanoseconds(throughput["median_real_time"], throughput["time_unit"])
+        latency_ns = to_nanoseconds(row["median_real_time"], row["time_unit"])
+        pairs.append(
+            {
+                "name": throughput["name"],
+                "throughput_ns": throughput_ns,
+                "latency_ns": latency_ns,
+                "latency_ratio": latency_ns / throughput_ns if throughput_ns > 0 else None,
+            }
+        )
+    return pairs
+
+
+def expected_scaling(case):
+    for pattern, exponent in EXPECTED_SCALING:
+        if pattern.search(case):
+            return exponent
+    return 1.0
+
+
+def width_scaling(medians):
+    """Group <case>/bits:<N> rows by case; time and ratio to 128 bits per width."""
+    times = {}
+    order = []
+    for row in medians:
+        match = WIDTH_PATTERN.search(row["name"])
+        if not match:
+            continue
+        case = row["name"][: match.start()] + row["name"][match.end() :]
+        if case not in times:
+            times[case] = {}
+            order.append(case)
+        times[case][int(match.group(1))] = to_nanoseconds(row["median_real_time"], row["time_unit"])
+    rows = []
+    for case in order:
+        base = times[case].get(BASE_WIDTH)
+        exponent = expected_scaling(case)
+        ratios = {}
+        over_expected = []
+        for bits, ns in sorted(times[case].items()):
+            ratio = ns / base if base else None
+            ratios[str(bits)] = ratio
+            if (
+                ratio is not None
+                and bits > BASE_WIDTH
+                and ratio > (float(bits) / BASE_WIDTH) ** exponent * (1.0 + SCALING_TOLERANCE)
+            ):
+                over_expected.append(bits)
+        rows.append(
+            {
+                "name": case,
+                "ns_per_op": dict((str(bits), ns) for bits, ns in times[case].items()),
+                "ratio_to_128": ratios,
+                "expected_exponent": exponent,
+                "over_expected_bits": over_expected,
+            }
+        )
+    return rows
+
+
 def summarize_document(document):
     benchmarks = document.get("benchmarks")
     if not isinstance(benchmarks, list) or not benchmarks:
@@ -42,16 +145,22 @@ def summarize_document(document):
         if name in seen:
             raise ValueError("duplicate median row: {0}".format(name))
         seen.add(name)
-        medians.append(
-            {
-                "name": name,
-                "median_real_time": row["real_time"],
-                "median_cpu_time": row["cpu_time"],
-                "time_unit": row["time_unit"],
-                "repetitions": row.get("repetitions"),
-                "real_time_cv": cvs.get(name),
-            }
+        median = {
+            "name": name,
+            "median_real_time": row["real_time"],
+            "median_cpu_time": row["cpu_time"],
+            "time_unit": row["time_unit"],
+            "repetitions": row.get("repetitions"),
+            "real_time_cv": cvs.get(name),
+        }
+        counters = dict(
+            (counter, row[counter])
+            for counter in PERF_COUNTERS
+            if isinstance(row.get(counter), (int, float))
         )
+        if counters:
+            median["perf_counters"] = counters
+        medians.append(median)
 
     if not medians:
         raise ValueError("benchmark document contains no median aggregate rows")
@@ -76,10 +185,33 @@ def summarize_document(document):
         "noisy_threshold": NOISY_CV_THRESHOLD,
         "noisy_count": len(noisy),
         "noisy_benchmarks": noisy,
+        "latency_pairs": latency_pairs(medians),
+        "width_scaling": width_scaling(medians),
         "benchmarks": medians,
     }
 
 
+def perf_counter_diff(baseline, suite):
+    """Relative change of each counter for rows that carry counters in both."""
+    baseline_rows = dict(
+        (row["name"], row["perf_counters"])
+        for row in baseline["benchmarks"]
+        if row.get("perf_counters")
+    )
+    diffs = []
+    for row in suite["benchmarks"]:
+        before = baseline_rows.get(row["name"])
+        after = row.get("perf_counters")
+        if not before or not after:
+            continue
+        changes = {}
+        for counter in PERF_COUNTERS:
+            if counter in before and counter in after and before[counter]:
+                changes[counter] = (after[counter] - before[counter]) / float(before[counter])
+        diffs.append({"name": row["name"], "changes": changes})
+    return diffs
+
+
 def percent(value):
     return "n/a" if value is None else "{0:.2f}%".format(value * 100.0)
 
@@ -135,6 +267,14 @@ def validate_suite(
         raise ValueError("{0}: missing required benchmark(s): {1}".format(name, ", ".join(missing)))
 
 
+def signed_percent(value):
+    return "n/a" if value is None else "{0:+.2f}%".format(value * 100.0)
+
+
+def format_counter(value):
+    return "n/a" if value is None else "{0:.2f}".format(value)
+
+
 def render_markdown(suites, metadata):
     lines = ["## 性能采样", ""]
     if metadata:
@@ -167,6 +307,100 @@ def render_markdown(suites, metadata):
         remaining = len(suite["noisy_benchmarks"]) - 10
         if remaining > 0:
             lines.append("  - 其余 {0} 项见规范化 JSON。".format(remaining))
+    for name, suite in sorted(suites.items()):
+        if not suite["latency_pairs"]:
+            continue
+        lines.extend(
+            [
+                "",
+                "`{0}` 吞吐与延迟（median real time，ns/op）：".format(name),
+                "",
+                "| 用例 | 吞吐 | 延迟 | 延迟/吞吐 |",
+                "| --- | ---: | ---: | ---: |",
+            ]
+        )
+        for row in suite["latency_pairs"]:
+            lines.append(
+                "| `{0}` | {1:.2f} | {2:.2f} | {3} |".format(
+                    row["name"],
+                    row["throughput_ns"],
+                    row["latency_ns"],
+                    "n/a" if row["latency_ratio"] is None else "{0:.2f}x".format(row["latency_ratio"]),
+                )
+            )
+    for name, suite in sorted(suites.items()):
+        if not suite["width_scaling"]:
+            continue
+        widths = sorted(
+            set(int(bits) for row in suite["width_scaling"] for bits in row["ns_per_op"])
+        )
+        ratio_widths = [bits for bits in widths if bits != BASE_WIDTH]
+        flagged = sum(1 for row in suite["width_scaling"] if row["over_expected_bits"])
+        lines.extend(
+            [
+                "",
+                "`{0}` 位宽扩展（median real time，ns/op；比值相对 {1}-bit；"
+                "超预期：耗时增长超过位宽增长的预期次幂 {2:.0f}% 以上，共 {3} 项）：".format(
+                    name, BASE_WIDTH, SCALING_TOLERANCE * 100.0, flagged
+                ),
+                "",
+                "| 用例 | "
+                + " | ".join(str(bits) for bits in widths)
+                + " | "
+                + " | ".join("{0}/{1}".format(bits, BASE_WIDTH) for bits in ratio_widths)
+                + " | 预期 | 超预期 |",
+                "| --- |" + " ---: |" * (len(widths) + len(ratio_widths) + 1) + " --- |",
+            ]
+        )
+        for row in suite["width_scaling"]:
+            cells = [format_counter(row["ns_per_op"].get(str(bits))) for bits in widths]
+            for bits in ratio_widths:
+                ratio = row["ratio_to_128"].get(str(bits))
+                cells.append("n/a" if ratio is None else "{0:.2f}x".format(ratio))
+            cells.append("n^{0:g}".format(row["expected_exponent"]))
+            cells.append(", ".join(str(bits) for bits in row["over_expected_bits"]))
+            lines.append("| `{0}` | {1} |".format(row["name"], " | ".join(cells)))
+    counter_header = " | ".join(PERF_COUNTERS)
+    counter_rule = " ---: |" * len(PERF_COUNTERS)
+    for name, suite in sorted(suites.items()):
+        rows = [row for row in suite["benchmarks"] if row.get("perf_counters")]
+        if not rows:
+            continue
+        lines.extend(
+            [
+                "",
+                "`{0}` 硬件计数器（每次迭代，median）：".format(name),
+                "",
+                "| 用例 | {0} |".format(counter_header),
+                "| --- |" + counter_rule,
+            ]
+        )
+        for row in rows:
+            lines.append(
+                "| `{0}` | {1} |".format(
+                    row["name"],
+                    " | ".join(format_counter(row["perf_counters"].get(c)) for c in PERF_COUNTERS),
+                )
+            )
+    for name, suite in sorted(suites.items()):
+        if not suite.get("perf_counter_diff"):
+            continue
+        lines.extend(
+            [
+                "",
+                "`{0}` 硬件计数器相对 baseline 的变化：".format(name),
+                "",
+                "| 用例 | {0} |".format(counter_header),
+                "| --- |" + counter_rule,
+            ]
+        )
+        for row in suite["perf_counter_diff"]:
+            lines.append(
+                "| `{0}` | {1} |".format(
+                    row["name"],
+                    " | ".join(signed_percent(row["changes"].get(c)) for c in PERF_COUNTERS),
+                )
+            )
     lines.extend(
         [
             "",
@@ -216,6 +450,11 @@ def parse_args(argv):
         metavar="NAME=BENCHMARK",
         help="required exact run_name for an input label; may be repeated",
     )
+    parser.add_argument(
+        "--baseline",
+        metavar="JSON",
+        help="normalized JSON from an earlier run; diff hardware counters of matching labels",
+    )
     parser.add_argument("--output", required=True, help="normalized JSON output")
     parser.add_argument("--markdown", help="optional Markdown summary output")
     return parser.parse_args(argv)
@@ -262,6 +501,12 @@ def main(argv=None):
                 expected_repetitions=args.expected_repetitions,
                 required=required_benchmarks.get(name, []),
             )
+        if args.baseline:
+            with open(args.baseline, "r") as baseline_file:
+                baseline_suites = json.load(baseline_file)["suites"]
+            for name, suite in suites.items():
+                if name in baseline_suites:
+                    suite["perf_counter_diff"] = perf_counter_diff(baseline_suites[name], suite)
     except (IOError, KeyError, TypeError, ValueError) as error:
         print("error: {0}".format(error), file=sys.stderr)
         return 2
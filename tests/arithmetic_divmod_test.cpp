@@ -1,3 +1,6 @@
+#include <limits>
+#include <random>
+#include <vector>
 #include <gint/gint.h>
 #include <gtest/gtest.h>
 
@@ -119,6 +122,95 @@ TEST(WideIntegerDivision, PublicDivModPreservesSignedEdgeSemantics)
     EXPECT_EQ(overflow_result.remainder, Int256(0));
 }
 
+namespace
+{
+template <typename Int>
+std::vector<Int> constant_division_dividends()
+{
+    std::vector<Int> values;
+    values.push_back(Int(0));
+    values.push_back(Int(1));
+    values.push_back(Int(9));
+    values.push_back(Int(UINT64_MAX));
+    values.push_back(std::numeric_limits<Int>::max());
+    values.push_back(std::numeric_limits<Int>::min());
+    Int pattern = Int(0x9e3779b97f4a7c15ULL);
+    for (unsigned i = 0; i < 24; ++i)
+    {
+        pattern = pattern * Int(0xbf58476d1ce4e5b9ULL) + Int(0x94d049bb133111ebULL);
+        values.push_back(pattern);
+        values.push_back(pattern >> static_cast<int>(i * 7 % Int::bits));
+        if (std::is_same<typename Int::signed_tag, signed>::value)
+            values.push_back(-(pattern >> 3));
+    }
+    return values;
+}
+
+template <uint64_t Divisor, typename Int>
+void expect_div_by_matches_operators()
+{
+    for (const Int & value : constant_division_dividends<Int>())
+    {
+        EXPECT_EQ(gint::div_by<Divisor>(value), value / Divisor);
+        EXPECT_EQ(gint::mod_by<Divisor>(value), value % Divisor);
+    }
+}
+
+template <uint64_t High, uint64_t Low, typename Int>
+void expect_div_by_wide_matches_operators()
+{
+    using Wide = gint::integer<(Int::bits < 256 ? 256 : Int::bits), typename Int::signed_tag>;
+    const Wide divisor = (Wide(High) << 64) | Wide(Low);
+    for (const Int & value : constant_division_dividends<Int>())
+    {
+        EXPECT_EQ((gint::div_by<High, Low>(value)), Int(Wide(value) / divisor));
+        EXPECT_EQ((gint::mod_by<High, Low>(value)), Int(Wide(value) % divisor));
+    }
+}
+
+template <typename Int>
+void expect_constant_divisors_match_operators()
+{
+    expect_div_by_matches_operators<1, Int>();
+    expect_div_by_matches_operators<3, Int>();
+    expect_div_by_matches_operators<10, Int>();
+    expect_div_by_matches_operators<1024, Int>();
+    expect_div_by_matches_operators<1000000007ULL, Int>();
+    expect_div_by_matches_operators<1000000000000000000ULL, Int>();
+    expect_div_by_matches_operators<10000000000000000000ULL, Int>();
+    expect_div_by_matches_operators<0x8000000000000000ULL, Int>();
+    expect_div_by_matches_operators<UINT64_MAX, Int>();
+    expect_div_by_wide_matches_operators<1, 0, Int>();
+    expect_div_by_wide_matches_operators<0x4b3b4ca85a86c47aULL, 0x098a224000000000ULL, Int>();
+    expect_div_by_wide_matches_operators<0x7fffffffffffffffULL, UINT64_MAX, Int>();
+    expect_div_by_wide_matches_operators<UINT64_MAX, UINT64_MAX, Int>();
+}
+} // namespace
+
+TEST(WideIntegerDivision, ConstantDivisorMatchesRuntimeDivision)
+{
+    expect_constant_divisors_match_operators<gint::integer<64, unsigned>>();
+    expect_constant_divisors_match_operators<gint::integer<64, signed>>();
+    expect_constant_divisors_match_operators<gint::UInt128>();
+    expect_constant_divisors_match_operators<gint::Int128>();
+    expect_constant_divisors_match_operators<gint::UInt256>();
+    expect_constant_divisors_match_operators<gint::Int256>();
+    expect_constant_divisors_match_operators<gint::integer<512, unsigned>>();
+    expect_constant_divisors_match_operators<gint::integer<1024, signed>>();
+}
+
+#if __cplusplus >= 201402L
+TEST(WideIntegerDivision, ConstantDivisorIsConstexpr)
+{
+    constexpr gint::UInt256 value = gint::UInt256(UINT64_MAX) << 100;
+    static_assert(gint::div_by<10>(gint::UInt256(1234567)) == gint::UInt256(123456), "constexpr div_by");
+    static_assert(gint::mod_by<10>(gint::Int256(-1234567)) == gint::Int256(-7), "constexpr mod_by");
+    static_assert(gint::div_by<1, 0>(value) == (value >> 64), "constexpr wide div_by");
+    static_assert(gint::mod_by<1, 0>(value) == (value & gint::UInt256(UINT64_MAX)), "constexpr wide mod_by");
+    EXPECT_EQ(gint::div_by<10>(value), value / 10);
+}
+#endif
+
 TEST(WideIntegerDivision, SignedSmallDivMod_NegativeDivisorRegression)
 {
     using Int256 = gint::integer<256, signed>;
@@ -621,6 +713,50 @@ TEST(WideIntegerDivision, S64UnsignedInteropAboveSignedRange)
     EXPECT_EQ(max_u64 % S64(2), S64(1));
 }
 
+TEST(WideIntegerDivision, SignedUnsignedInteropMatchesWidenedReference)
+{
+    using S64 = gint::integer<64, signed>;
+    using S128 = gint::Int128;
+    using Wide = gint::Int256;
+    const unsigned __int128 signed_min_magnitude = static_cast<unsigned __int128>(1) << 127;
+    const unsigned __int128 unsigned_values[] = {
+        signed_min_magnitude,
+        signed_min_magnitude + 1,
+        ~static_cast<unsigned __int128>(0),
+        (static_cast<unsigned __int128>(0xfedcba9876543210ULL) << 64) | 0x0123456789abcdefULL,
+    };
+    const S128 signed_values[] = {
+        std::numeric_limits<S128>::min(),
+        std::numeric_limits<S128>::max(),
+        S128(-1),
+        S128(1),
+        S128(-7),
+        S128(0x7fffffffffffffffLL),
+        -(S128(1) << 64) - S128(3),
+    };
+
+    for (const unsigned __int128 u : unsigned_values)
+    {
+        for (const S128 & s : signed_values)
+        {
+            EXPECT_EQ(s / u, S128(Wide(s) / Wide(u)));
+            EXPECT_EQ(s % u, S128(Wide(s) % Wide(u)));
+            EXPECT_EQ(u / s, S128(Wide(u) / Wide(s)));
+            EXPECT_EQ(u % s, S128(Wide(u) % Wide(s)));
+
+            const S64 narrow = S64(s);
+            if (narrow == S64(0))
+                continue;
+            EXPECT_EQ(narrow / u, S64(Wide(narrow) / Wide(u)));
+            EXPECT_EQ(narrow % u, S64(Wide(narrow) % Wide(u)));
+            EXPECT_EQ(u / narrow, S64(Wide(u) / Wide(narrow)));
+            EXPECT_EQ(u % narrow, S64(Wide(u) % Wide(narrow)));
+            EXPECT_EQ(static_cast<uint64_t>(u) / narrow, S64(Wide(static_cast<uint64_t>(u)) / Wide(narrow)));
+            EXPECT_EQ(static_cast<uint64_t>(u) % narrow, S64(Wide(static_cast<uint64_t>(u)) % Wide(narrow)));
+        }
+    }
+}
+
 TEST(WideIntegerDivision, CompoundDivModPreservesUnsignedPromotion)
 {
     using S64 = gint::integer<64, signed>;
@@ -1247,3 +1383,142 @@ TEST(WideIntegerDivision, DivLarge3QhatAdjustmentBreak)
     U256 r = lhs - q * divisor;
     EXPECT_LT(r, divisor);
 }
+
+namespace
+{
+template <size_t Bits>
+void expect_odd_width_division_matches_wide(uint64_t seed)
+{
+    using U = gint::integer<Bits, unsigned>;
+    using S = gint::integer<Bits, signed>;
+    using Wide = gint::integer<1024, signed>;
+    std::mt19937_64 rng(seed);
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        U a = 0;
+        U b = 0;
+        for (size_t i = 0; i < U::limbs; ++i)
+        {
+            a = (a << 64) | U(rng());
+            b = (b << 64) | U(rng());
+        }
+        b >>= static_cast<int>(rng() % Bits);
+        if (b == U(0))
+            b = 1;
+        EXPECT_EQ(a / b, U(Wide(a) / Wide(b)));
+        EXPECT_EQ(a % b, U(Wide(a) % Wide(b)));
+
+        const S lhs(a);
+        const S rhs(b);
+        if (lhs == std::numeric_limits<S>::min() && rhs == S(-1))
+            continue;
+        EXPECT_EQ(lhs / rhs, S(Wide(lhs) / Wide(rhs)));
+        EXPECT_EQ(lhs % rhs, S(Wide(lhs) % Wide(rhs)));
+    }
+}
+} // namespace
+
+TEST(WideIntegerDivision, OddLimbWidthsMatchWideReference)
+{
+    expect_odd_width_division_matches_wide<192>(1);
+    expect_odd_width_division_matches_wide<320>(2);
+    expect_odd_width_division_matches_wide<384>(3);
+    expect_odd_width_division_matches_wide<448>(4);
+}
+
+namespace
+{
+// Quotient/remainder identity at widths with no wider reference type. Limbs
+// are drawn from a few saturated patterns so the reciprocal estimate hits its
+// q = 2^64 - 1 and add-back corrections.
+template <size_t Bits>
+void expect_wide_division_identity(uint64_t seed)
+{
+    using U = gint::integer<Bits, unsigned>;
+    const uint64_t patterns[] = {0, 1, ~uint64_t(0), ~uint64_t(0) - 1, uint64_t(1) << 63, (uint64_t(1) << 63) - 1};
+    std::mt19937_64 rng(seed);
+    for (int iteration = 0; iteration < 300; ++iteration)
+    {
+        const size_t divisor_limbs = 2 + rng() % (U::limbs - 1);
+        const size_t dividend_limbs = divisor_limbs + rng() % (U::limbs - divisor_limbs + 1);
+        U a = 0;
+        U b = 0;
+        for (size_t i = 0; i < dividend_limbs; ++i)
+            a = (a << 64) | U(rng() % 3 == 0 ? patterns[rng() % 6] : rng());
+        for (size_t i = 0; i < divisor_limbs; ++i)
+            b = (b << 64) | U(rng() % 3 == 0 ? patterns[rng() % 6] : rng());
+        if (iteration % 4 == 0)
+        {
+            // Dividend top limbs equal to the divisor's.
+            const int gap = static_cast<int>(64 * (dividend_limbs - divisor_limbs));
+            a = (b << gap) | (a & ((U(1) << gap) - U(1)));
+        }
+        if (b == U(0))
+            b = 3;
+        const U q = a / b;
+        const U r = a % b;
+        EXPECT_LT(r, b);
+        EXPECT_EQ(q * b + r, a);
+    }
+}
+} // namespace
+
+TEST(WideIntegerDivision, Wide2048And4096Identity)
+{
+    expect_wide_division_identity<2048>(1);
+    expect_wide_division_identity<4096>(2);
+    expect_wide_division_identity<3072>(3);
+}
+
+TEST(WideIntegerDivision, Wide4096MatchesNarrowReference)
+{
+    using U = gint::integer<4096, unsigned>;
+    using Narrow = gint::integer<1024, unsigned>;
+    std::mt19937_64 rng(4);
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        Narrow a = 0;
+        Narrow b = 0;
+        for (size_t i = 0; i < Narrow::limbs; ++i)
+        {
+            a = (a << 64) | Narrow(rng());
+            b = (b << 64) | Narrow(rng());
+        }
+        b >>= static_cast<int>(rng() % 1000);
+        if (b == Narrow(0))
+            b = 1;
+        // Both widths take different kernels for the same values.
+        EXPECT_EQ(U(a) / U(b), U(a / b));
+        EXPECT_EQ(U(a) % U(b), U(a % b));
+    }
+}
+
+#if __cplusplus >= 201402L && defined(__has_builtin)
+#    if __has_builtin(__builtin_is_constant_evaluated)
+TEST(WideIntegerDivision, DivisionIsConstexpr)
+{
+    using Int = gint::Int256;
+    constexpr gint::UInt256 value = (gint::UInt256(UINT64_MAX) << 150) | gint::UInt256(12345);
+    constexpr gint::UInt256 divisor = (gint::UInt256(1) << 70) + 3;
+    constexpr gint::UInt256 quotient = value / divisor;
+    constexpr gint::UInt256 remainder = value % divisor;
+    static_assert(quotient * divisor + remainder == value && remainder < divisor, "multi-limb divisor");
+    static_assert(value / 10u == gint::div_by<10>(value) && value % 10 == gint::mod_by<10>(value), "single-limb divisor");
+
+    static_assert(Int(-7) / Int(2) == Int(-3) && Int(-7) % Int(2) == Int(-1), "truncates toward zero");
+    static_assert(Int(7) / -2 == Int(-3) && Int(7) % -2 == Int(1), "remainder follows the dividend");
+    static_assert(std::numeric_limits<Int>::min() / Int(-1) == std::numeric_limits<Int>::min(), "min / -1 wraps");
+    static_assert(std::numeric_limits<gint::Int128>::min() / (u128(1) << 127) == -1, "out-of-range unsigned divisor");
+    static_assert(gint::Int128(-1) % (u128(1) << 127) == -1, "out-of-range unsigned divisor remainder");
+
+    constexpr gint::divmod_result<gint::UInt256> qr = gint::divmod(value, divisor);
+    static_assert(qr.quotient == quotient && qr.remainder == remainder, "divmod");
+
+    gint::UInt256 runtime_value = value;
+    gint::UInt256 runtime_divisor = divisor;
+    runtime_value /= runtime_divisor;
+    EXPECT_EQ(runtime_value, quotient);
+    EXPECT_EQ(value % runtime_divisor, remainder);
+}
+#    endif
+#endif
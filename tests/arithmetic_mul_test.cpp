@@ -1,3 +1,4 @@
+#include <random>
 #include <gint/gint.h>
 #include <gtest/gtest.h>
 
@@ -159,3 +160,151 @@ TEST(WideIntegerMultiplication, UInt256_AdditionCarryChain)
     U256 sum = a + b;
     EXPECT_EQ(sum - b, a);
 }
+
+namespace
+{
+// Compare a non-power-of-two width against 1024-bit arithmetic truncated back to Bits.
+template <size_t Bits>
+void expect_odd_width_matches_wide(uint64_t seed)
+{
+    using U = gint::integer<Bits, unsigned>;
+    using Wide = gint::integer<1024, unsigned>;
+    std::mt19937_64 rng(seed);
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        U a = 0;
+        U b = 0;
+        for (size_t i = 0; i < U::limbs; ++i)
+        {
+            a = (a << 64) | U(rng());
+            b = (b << 64) | U(rng());
+        }
+        b >>= static_cast<int>(rng() % Bits);
+        EXPECT_EQ(a * b, U(Wide(a) * Wide(b)));
+        EXPECT_EQ(a + b, U(Wide(a) + Wide(b)));
+        EXPECT_EQ(b - a, U(Wide(b) - Wide(a)));
+    }
+}
+} // namespace
+
+TEST(WideIntegerMultiplication, OddLimbWidthsMatchWideReference)
+{
+    expect_odd_width_matches_wide<192>(1);
+    expect_odd_width_matches_wide<320>(2);
+    expect_odd_width_matches_wide<384>(3);
+    expect_odd_width_matches_wide<448>(4);
+    expect_odd_width_matches_wide<960>(5);
+
+    using U192 = gint::integer<192, unsigned>;
+    const U192 max = ~U192(0);
+    EXPECT_EQ(max * max, U192(1));
+    EXPECT_EQ(max + U192(1), U192(0));
+    EXPECT_EQ(U192(0) - U192(1), max);
+}
+
+TEST(WideIntegerMultiplication, KaratsubaMatchesBasecase)
+{
+    std::mt19937_64 rng(5);
+    for (size_t n : {16u, 17u, 24u, 32u, 48u, 64u})
+    {
+        for (int iteration = 0; iteration < 20; ++iteration)
+        {
+            uint64_t a[64];
+            uint64_t b[64];
+            for (size_t i = 0; i < n; ++i)
+            {
+                // Saturated limbs drive every carry out of the middle term.
+                a[i] = iteration % 4 == 0 ? ~uint64_t(0) : rng();
+                b[i] = iteration % 4 == 1 ? ~uint64_t(0) : rng();
+            }
+            if (iteration % 4 == 2)
+                a[n / 2] = 0;
+            uint64_t expected[128];
+            uint64_t actual[128];
+            gint::detail::mul_limbs_full_basecase(expected, a, b, n);
+            gint::detail::mul_limbs_full_n(actual, a, b, n);
+            for (size_t i = 0; i < 2 * n; ++i)
+                ASSERT_EQ(actual[i], expected[i]) << "n=" << n << " limb " << i;
+        }
+    }
+}
+
+TEST(WideIntegerMultiplication, TruncatedKaratsubaMatchesBasecase)
+{
+    std::mt19937_64 rng(7);
+    for (size_t n : {16u, 17u, 24u, 32u, 48u, 64u})
+    {
+        for (int iteration = 0; iteration < 20; ++iteration)
+        {
+            uint64_t a[64];
+            uint64_t b[64];
+            for (size_t i = 0; i < n; ++i)
+            {
+                a[i] = iteration % 4 == 0 ? ~uint64_t(0) : rng();
+                b[i] = iteration % 4 == 1 ? ~uint64_t(0) : rng();
+            }
+            uint64_t expected[128];
+            uint64_t actual[64];
+            gint::detail::mul_limbs_full_basecase(expected, a, b, n);
+            gint::detail::mul_limbs_low_n(actual, a, b, n);
+            for (size_t i = 0; i < n; ++i)
+                ASSERT_EQ(actual[i], expected[i]) << "n=" << n << " limb " << i;
+        }
+    }
+}
+
+TEST(WideIntegerMultiplication, Wide2048FixedProductMatchesTruncated)
+{
+    using U = gint::integer<2048, unsigned>;
+    using Q = gint::fixed<2048, 1024, unsigned>;
+    using Integral = gint::fixed<2048, 0, unsigned>;
+    std::mt19937_64 rng(6);
+    for (int iteration = 0; iteration < 20; ++iteration)
+    {
+        U a = 0;
+        U b = 0;
+        for (size_t i = 0; i < U::limbs; ++i)
+        {
+            a = (a << 64) | U(rng());
+            b = (b << 64) | U(rng());
+        }
+        // The low half of the fixed-point full product must agree with the
+        // truncated operator*, which splits the cross products differently.
+        EXPECT_EQ((Integral::from_raw(a) * Integral::from_raw(b)).raw(), a * b);
+
+        // With both operands below 2^1024 the truncated product is exact.
+        const U low_a = a >> 1024;
+        const U low_b = b >> 1024;
+        EXPECT_EQ((Q::from_raw(low_a) * Q::from_raw(low_b)).raw(), (low_a * low_b) >> 1024);
+    }
+}
+
+#if __cplusplus >= 201402L && defined(__has_builtin)
+#    if __has_builtin(__builtin_is_constant_evaluated)
+constexpr gint::UInt256 constexpr_pow10(int n)
+{
+    gint::UInt256 result = 1;
+    while (n-- > 0)
+        result *= 10;
+    return result;
+}
+
+TEST(WideIntegerMultiplication, ConstexprMatchesRuntime)
+{
+    using U512 = gint::integer<512, unsigned>;
+    constexpr gint::UInt256 p40 = constexpr_pow10(40);
+    static_assert(p40 == gint::UInt256(10000000000ULL) * gint::UInt256(1000000000000000ULL) * 1000000000000000ULL, "power table");
+    static_assert(gint::Int256(-3) * gint::Int256(7) == gint::Int256(-21), "signed product");
+    static_assert(std::numeric_limits<gint::UInt256>::max() * std::numeric_limits<gint::UInt256>::max() == 1, "wraps");
+    static_assert((U512(1) << 300) * (U512(1) << 211) == (U512(1) << 511), "512-bit product");
+    static_assert(3 * gint::UInt128(5) * 7u == 105, "mixed builtin operands");
+
+    volatile int digits = 40;
+    EXPECT_EQ(p40, constexpr_pow10(digits));
+    gint::UInt256 runtime = gint::UInt256(1) << 130;
+    runtime = runtime + gint::UInt256(digits);
+    constexpr gint::UInt256 expected = ((gint::UInt256(1) << 130) + 40) * ((gint::UInt256(1) << 130) + 40);
+    EXPECT_EQ(runtime * runtime, expected);
+}
+#    endif
+#endif
@@ -1,3 +1,4 @@
+#include <vector>
 #include <fmt/format.h>
 #include <gint/gint.h>
 #include <gtest/gtest.h>
@@ -98,3 +99,184 @@ TEST(WideIntegerBitwise, BitwiseOps512)
     U b = U(1);
     EXPECT_EQ((a | b) & a, a);
 }
+
+namespace
+{
+template <typename U>
+int reference_countl_zero(const U & value)
+{
+    int count = 0;
+    for (int bit = static_cast<int>(U::bits) - 1; bit >= 0 && ((value >> bit) & U(1)) == U(0); --bit)
+        ++count;
+    return count;
+}
+
+template <typename U>
+int reference_countr_zero(const U & value)
+{
+    int count = 0;
+    for (int bit = 0; bit < static_cast<int>(U::bits) && ((value >> bit) & U(1)) == U(0); ++bit)
+        ++count;
+    return count;
+}
+
+template <typename U>
+int reference_popcount(const U & value)
+{
+    int count = 0;
+    for (int bit = 0; bit < static_cast<int>(U::bits); ++bit)
+        count += ((value >> bit) & U(1)) != U(0);
+    return count;
+}
+
+template <typename U>
+std::vector<U> bit_manipulation_values()
+{
+    std::vector<U> values;
+    values.push_back(U(0));
+    values.push_back(U(1));
+    values.push_back(~U(0));
+    values.push_back(U(1) << static_cast<int>(U::bits - 1));
+    values.push_back(U(0x8000000000000000ULL));
+    U pattern = U(0x0123456789abcdefULL);
+    for (int i = 0; i < 12; ++i)
+    {
+        pattern = pattern * U(0x9e3779b97f4a7c15ULL) + U(0x632be59bd9b4e019ULL);
+        values.push_back(pattern);
+        values.push_back(pattern << (i * 37 % static_cast<int>(U::bits)));
+        values.push_back(pattern >> (i * 53 % static_cast<int>(U::bits)));
+        values.push_back(U(1) << (i * 29 % static_cast<int>(U::bits)));
+    }
+    return values;
+}
+
+template <typename U>
+void expect_bit_manipulation_matches_reference()
+{
+    const int bits = static_cast<int>(U::bits);
+    for (const U & value : bit_manipulation_values<U>())
+    {
+        EXPECT_EQ(gint::countl_zero(value), reference_countl_zero(value));
+        EXPECT_EQ(gint::countr_zero(value), reference_countr_zero(value));
+        EXPECT_EQ(gint::countl_one(value), reference_countl_zero(~value));
+        EXPECT_EQ(gint::countr_one(value), reference_countr_zero(~value));
+        EXPECT_EQ(gint::popcount(value), reference_popcount(value));
+        EXPECT_EQ(gint::bit_width(value), bits - reference_countl_zero(value));
+        EXPECT_EQ(gint::has_single_bit(value), reference_popcount(value) == 1);
+
+        const int counts[] = {0, 1, 7, 63, 64, 65, 127, bits - 1, bits, bits + 3, -1, -64, -bits - 5};
+        for (const int count : counts)
+        {
+            const int left = ((count % bits) + bits) % bits;
+            const U expected_left = left == 0 ? value : (value << left) | (value >> (bits - left));
+            const U expected_right = left == 0 ? value : (value >> left) | (value << (bits - left));
+            EXPECT_EQ(gint::rotl(value, count), expected_left);
+            EXPECT_EQ(gint::rotr(value, count), expected_right);
+            EXPECT_EQ(gint::rotl(value, count), gint::rotr(value, -count));
+        }
+
+        U expected_swap = 0;
+        for (int byte = 0; byte < bits / 8; ++byte)
+            expected_swap |= ((value >> (8 * byte)) & U(0xFF)) << (bits - 8 - 8 * byte);
+        EXPECT_EQ(gint::byteswap(value), expected_swap);
+        EXPECT_EQ(gint::byteswap(gint::byteswap(value)), value);
+    }
+}
+} // namespace
+
+TEST(WideIntegerBitwise, BitManipulationMatchesReference)
+{
+    expect_bit_manipulation_matches_reference<gint::integer<64, unsigned>>();
+    expect_bit_manipulation_matches_reference<gint::UInt128>();
+    expect_bit_manipulation_matches_reference<gint::UInt256>();
+    expect_bit_manipulation_matches_reference<gint::integer<512, unsigned>>();
+    expect_bit_manipulation_matches_reference<gint::integer<1024, unsigned>>();
+}
+
+TEST(WideIntegerBitwise, BitManipulationMatchesNativeU64)
+{
+    const uint64_t values[] = {0, 1, 0x8000000000000000ULL, 0x00f0000000000100ULL, ~uint64_t(0)};
+    for (const uint64_t value : values)
+    {
+        const gint::integer<64, unsigned> wide = value;
+        EXPECT_EQ(gint::popcount(wide), __builtin_popcountll(value));
+        EXPECT_EQ(gint::countl_zero(wide), value == 0 ? 64 : __builtin_clzll(value));
+        EXPECT_EQ(gint::countr_zero(wide), value == 0 ? 64 : __builtin_ctzll(value));
+        EXPECT_EQ(static_cast<uint64_t>(gint::byteswap(wide)), __builtin_bswap64(value));
+    }
+    EXPECT_EQ(gint::byteswap(gint::Int128(-2)), gint::Int128(-1) - (gint::Int128(1) << 120));
+}
+
+#if __cplusplus >= 201402L
+TEST(WideIntegerBitwise, BitManipulationIsConstexpr)
+{
+    constexpr gint::UInt256 value = (gint::UInt256(1) << 200) | gint::UInt256(0x10);
+    static_assert(gint::countl_zero(value) == 55, "countl_zero");
+    static_assert(gint::countr_zero(value) == 4, "countr_zero");
+    static_assert(gint::popcount(value) == 2, "popcount");
+    static_assert(gint::bit_width(value) == 201, "bit_width");
+    static_assert(!gint::has_single_bit(value), "has_single_bit");
+    static_assert(gint::rotl(value, 56) == ((gint::UInt256(1) << 0) | gint::UInt256(0x1000000000000000ULL)), "rotl");
+    static_assert(gint::rotr(gint::rotl(value, 77), 77) == value, "rotr");
+    static_assert(gint::byteswap(gint::UInt256(0xAB)) == (gint::UInt256(0xAB) << 248), "byteswap");
+    EXPECT_EQ(gint::popcount(value), 2);
+}
+#endif
+
+namespace
+{
+template <typename Int>
+void expect_logarithms_at_powers_of_ten()
+{
+    using U = gint::integer<Int::bits, unsigned>;
+    const bool is_signed = std::numeric_limits<Int>::is_signed;
+    const U limit = is_signed ? U(1) << static_cast<int>(Int::bits - 1) : U(0);
+    U power = 1;
+    for (int exponent = 0;; ++exponent)
+    {
+        const Int value = Int(power);
+        EXPECT_EQ(gint::ilog10(value), exponent);
+        EXPECT_EQ(gint::decimal_digits(value), exponent + 1);
+        EXPECT_EQ(gint::ilog10(value - Int(1)), exponent - 1);
+        EXPECT_EQ(gint::decimal_digits(value - Int(1)), exponent == 0 ? 1 : exponent);
+        if (is_signed)
+        {
+            EXPECT_EQ(gint::decimal_digits(Int(0) - value), exponent + 1);
+        }
+        EXPECT_EQ(gint::ilog2(value), gint::bit_width(power) - 1);
+        const U next = power * U(10);
+        if (next / U(10) != power || (limit != U(0) && next >= limit))
+            break;
+        power = next;
+    }
+    EXPECT_EQ(gint::ilog10(Int(0)), -1);
+    EXPECT_EQ(gint::ilog2(Int(0)), -1);
+    EXPECT_EQ(gint::decimal_digits(Int(0)), 1);
+    EXPECT_EQ(gint::decimal_digits(std::numeric_limits<Int>::max()), static_cast<int>(gint::to_string(std::numeric_limits<Int>::max()).size()));
+    EXPECT_EQ(gint::ilog2(std::numeric_limits<Int>::max()), static_cast<int>(Int::bits) - (is_signed ? 2 : 1));
+}
+} // namespace
+
+TEST(WideIntegerBitwise, LogarithmsMatchPowersOfTen)
+{
+    expect_logarithms_at_powers_of_ten<gint::integer<64, unsigned>>();
+    expect_logarithms_at_powers_of_ten<gint::Int128>();
+    expect_logarithms_at_powers_of_ten<gint::UInt256>();
+    expect_logarithms_at_powers_of_ten<gint::Int256>();
+    expect_logarithms_at_powers_of_ten<gint::integer<512, unsigned>>();
+    expect_logarithms_at_powers_of_ten<gint::integer<1024, signed>>();
+    EXPECT_EQ(gint::ilog10(gint::Int256(-5)), -1);
+    EXPECT_EQ(gint::ilog2(gint::Int256(-5)), -1);
+    EXPECT_EQ(gint::decimal_digits(std::numeric_limits<gint::Int256>::min()), 77);
+}
+
+#if __cplusplus >= 201402L
+TEST(WideIntegerBitwise, LogarithmsAreConstexpr)
+{
+    constexpr gint::UInt256 value = gint::UInt256(1) << 200;
+    static_assert(gint::ilog2(value) == 200, "ilog2");
+    static_assert(gint::ilog10(value) == 60, "ilog10");
+    static_assert(gint::decimal_digits(gint::Int128(-999)) == 3, "decimal_digits");
+    EXPECT_EQ(gint::ilog10(value), 60);
+}
+#endif
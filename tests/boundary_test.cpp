@@ -32,3 +32,42 @@ TEST(WideIntegerBoundary, Signed512)
     S max = ~min;
     EXPECT_TRUE(max > min);
 }
+
+TEST(WideIntegerBoundary, Signed192)
+{
+    using S = gint::integer<192, signed>;
+    const S min = std::numeric_limits<S>::min();
+    const S max = std::numeric_limits<S>::max();
+    EXPECT_EQ(min, -(S(1) << 190) * S(2));
+    EXPECT_EQ(max, ~min);
+    EXPECT_EQ(max + S(1), min);
+    EXPECT_EQ(gint::to_string(max), "3138550867693340381917894711603833208051177722232017256447");
+    EXPECT_EQ(gint::from_string<S>(gint::to_string(min)), min);
+}
+
+TEST(WideIntegerBoundary, Signed4096)
+{
+    using S = gint::integer<4096, signed>;
+    using U = gint::integer<4096, unsigned>;
+    const S min = std::numeric_limits<S>::min();
+    const S max = std::numeric_limits<S>::max();
+    EXPECT_EQ(max + S(1), min);
+    EXPECT_EQ(std::numeric_limits<S>::digits10, 1232);
+    EXPECT_EQ(gint::to_string(max).size(), 1233u);
+    EXPECT_EQ(gint::from_string<S>(gint::to_string(min)), min);
+    EXPECT_EQ(gint::decimal_digits(std::numeric_limits<U>::max()), 1234);
+
+    // Above 1024 bits decimal_digits scales a sparse power-of-ten table; walk
+    // every boundary.
+    U power = 1;
+    for (int exponent = 0; exponent <= 1233; ++exponent)
+    {
+        EXPECT_EQ(gint::decimal_digits(power), exponent + 1);
+        if (exponent != 0)
+        {
+            EXPECT_EQ(gint::decimal_digits(U(power - U(1))), exponent);
+        }
+        if (exponent != 1233)
+            power *= U(10);
+    }
+}
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include "random_limbs.h"
+
+namespace
+{
+// Boundaries drawn from `low_limbs` random limbs (so higher limbs are shared)
+// plus duplicates; queries include every boundary and its neighbours.
+template <typename Int>
+void expect_matches_upper_bound(uint64_t seed, size_t count, size_t low_limbs)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<Int> boundaries;
+    for (size_t i = 0; i < count; ++i)
+        boundaries.push_back(gint_test::random_limbs<Int>(rng, low_limbs));
+    if (count > 2)
+        boundaries[1] = boundaries[0];
+    std::sort(boundaries.begin(), boundaries.end());
+    const gint::bucketizer<Int> buckets(boundaries.data(), boundaries.size());
+    EXPECT_EQ(buckets.size(), count);
+
+    std::vector<Int> queries;
+    for (const Int & boundary : boundaries)
+    {
+        queries.push_back(boundary);
+        queries.push_back(boundary - Int(1));
+        queries.push_back(boundary + Int(1));
+    }
+    for (int i = 0; i < 200; ++i)
+        queries.push_back(gint_test::random_limbs<Int>(rng, i % 2 == 0 ? low_limbs : Int::limbs));
+    queries.push_back(std::numeric_limits<Int>::min());
+    queries.push_back(std::numeric_limits<Int>::max());
+
+    std::vector<size_t> batch(queries.size());
+    buckets.lookup(queries.data(), queries.size(), batch.data());
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        const size_t expected = static_cast<size_t>(std::upper_bound(boundaries.begin(), boundaries.end(), queries[i]) - boundaries.begin());
+        EXPECT_EQ(buckets.lookup(queries[i]), expected) << i;
+        EXPECT_EQ(batch[i], expected) << i;
+    }
+}
+} // namespace
+
+TEST(Bucketizer, MatchesUpperBound)
+{
+    expect_matches_upper_bound<gint::UInt256>(1, 16, 4);
+    expect_matches_upper_bound<gint::UInt256>(2, 1000, 1);
+    expect_matches_upper_bound<gint::UInt256>(3, 255, 2);
+    expect_matches_upper_bound<gint::Int256>(4, 256, 4);
+    expect_matches_upper_bound<gint::Int128>(5, 33, 1);
+    expect_matches_upper_bound<gint::UInt128>(6, 1, 2);
+    expect_matches_upper_bound<gint::integer<192, unsigned>>(7, 100, 3);
+}
+
+TEST(Bucketizer, EmptyAndEqualBoundaries)
+{
+    const gint::bucketizer<gint::UInt256> none;
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.lookup(gint::UInt256(5)), 0u);
+    const gint::UInt256 queries[9] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    size_t out[9];
+    none.lookup(queries, 9, out);
+    EXPECT_EQ(out[8], 0u);
+
+    const std::vector<gint::Int128> same(5, gint::Int128(-3));
+    const gint::bucketizer<gint::Int128> tiers(same.data(), same.size());
+    EXPECT_EQ(tiers.lookup(gint::Int128(-4)), 0u);
+    EXPECT_EQ(tiers.lookup(gint::Int128(-3)), 5u);
+    EXPECT_EQ(tiers.lookup(gint::Int128(7)), 5u);
+}
@@ -57,6 +57,18 @@ endfunction()
 expect_compile_failure(cxx98 c++98 "gint requires C++11 or later")
 expect_compile_failure(msvc_abi c++11 "gint does not support MSVC or clang-cl" -D_MSC_VER=1930)
 expect_compile_failure(no_int128 c++11 "gint requires compiler support for __int128" -U__SIZEOF_INT128__)
+expect_compile_failure(
+    literal_out_of_range
+    c++14
+    "gint literal does not fit in the literal's type"
+    -DGINT_HEADER_CONTRACT_LITERAL_OUT_OF_RANGE
+)
+expect_compile_failure(
+    literal_invalid_digit
+    c++14
+    "gint literal contains a character that is not a digit of its base"
+    -DGINT_HEADER_CONTRACT_LITERAL_INVALID_DIGIT
+)
 expect_compile_failure(
     gcc_4_8_4
     c++11
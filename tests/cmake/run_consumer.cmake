@@ -33,6 +33,7 @@ if(GINT_CONSUMER_KIND STREQUAL "package")
     set(expected_install_files
         "include/gint/core.h"
         "include/gint/gint.h"
+        "include/gint/parallel.h"
         "${GINT_INSTALL_CMAKE_DIR}/gintConfig.cmake"
         "${GINT_INSTALL_CMAKE_DIR}/gintConfigVersion.cmake"
         "${GINT_INSTALL_CMAKE_DIR}/gintCompilerContract.cmake"
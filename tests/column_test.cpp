@@ -0,0 +1,108 @@
+#include <random>
+#include <vector>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include "random_limbs.h"
+
+namespace
+{
+template <typename Int>
+std::vector<Int> random_rows(std::mt19937_64 & rng, size_t count)
+{
+    std::vector<Int> rows;
+    for (size_t i = 0; i < count; ++i)
+        rows.push_back(gint_test::random_limb_pattern<Int>(rng));
+    // Equal neighbours and rows differing only in the low limb.
+    for (size_t i = 3; i < count; i += 7)
+        rows[i] = rows[i - 1] ^ Int(i % 2);
+    return rows;
+}
+
+template <size_t Bits, typename Signed>
+void expect_column_matches_rows(uint64_t seed)
+{
+    using Int = gint::integer<Bits, Signed>;
+    using Column = gint::column<Bits, Signed>;
+    std::mt19937_64 rng(seed);
+    // Not a multiple of the block or lane count, so tails are covered too.
+    const size_t count = 600 + seed % 7;
+    const std::vector<Int> a = random_rows<Int>(rng, count);
+    std::vector<Int> b = random_rows<Int>(rng, count);
+    for (size_t i = 0; i < count; i += 5)
+        b[i] = a[i];
+    const Column ca(a.data(), count);
+    const Column cb(b.data(), count);
+
+    const Column sum = ca + cb;
+    const Column difference = ca - cb;
+    const Column low = min(ca, cb);
+    const Column high = max(ca, cb);
+    std::vector<unsigned char> equal(count);
+    std::vector<unsigned char> less(count);
+    equal_mask(ca, cb, equal.data());
+    less_mask(ca, cb, less.data());
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(sum[i], a[i] + b[i]) << i;
+        EXPECT_EQ(difference[i], a[i] - b[i]) << i;
+        EXPECT_EQ(equal[i], a[i] == b[i] ? 1 : 0) << i;
+        EXPECT_EQ(less[i], a[i] < b[i] ? 1 : 0) << i;
+        EXPECT_EQ(low[i], a[i] < b[i] ? a[i] : b[i]) << i;
+        EXPECT_EQ(high[i], a[i] < b[i] ? b[i] : a[i]) << i;
+    }
+}
+} // namespace
+
+TEST(Column, StoresLimbPlanes)
+{
+    const gint::UInt256 value = (gint::UInt256(3) << 192) | (gint::UInt256(2) << 64) | gint::UInt256(1);
+    gint::column<256, unsigned> rows(5, value);
+    EXPECT_EQ(rows.size(), 5u);
+    EXPECT_EQ(rows.plane(0)[4], 1u);
+    EXPECT_EQ(rows.plane(1)[4], 2u);
+    EXPECT_EQ(rows.plane(2)[4], 0u);
+    EXPECT_EQ(rows.plane(3)[4], 3u);
+    rows.plane(2)[1] = 7;
+    EXPECT_EQ(rows[1], value | (gint::UInt256(7) << 128));
+
+    rows.push_back(gint::UInt256(9));
+    rows.resize(8);
+    EXPECT_EQ(rows[5], gint::UInt256(9));
+    EXPECT_EQ(rows[7], gint::UInt256(0));
+    rows.set(7, value);
+    EXPECT_EQ(rows[7], value);
+    rows.clear();
+    EXPECT_TRUE(rows.empty());
+}
+
+TEST(Column, PackAndUnpackRoundTrip)
+{
+    std::mt19937_64 rng(1);
+    const std::vector<gint::Int256> values = random_rows<gint::Int256>(rng, 40);
+    gint::column<256, signed> rows(50);
+    rows.pack(10, values.size(), values.data());
+    EXPECT_EQ(rows[9], gint::Int256(0));
+    std::vector<gint::Int256> out(values.size());
+    rows.unpack(10, out.size(), out.data());
+    EXPECT_EQ(out, values);
+}
+
+TEST(Column, ArithmeticAndMasksMatchRows)
+{
+    expect_column_matches_rows<128, unsigned>(2);
+    expect_column_matches_rows<256, unsigned>(3);
+    expect_column_matches_rows<256, signed>(4);
+    expect_column_matches_rows<512, signed>(5);
+    expect_column_matches_rows<64, signed>(6);
+}
+
+TEST(Column, CompoundAssignmentWraps)
+{
+    const gint::UInt256 top = ~gint::UInt256(0);
+    gint::column<256, unsigned> rows(3, top);
+    rows += gint::column<256, unsigned>(3, gint::UInt256(1));
+    EXPECT_EQ(rows[2], gint::UInt256(0));
+    rows -= gint::column<256, unsigned>(3, gint::UInt256(1));
+    EXPECT_EQ(rows[0], top);
+}
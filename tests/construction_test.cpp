@@ -29,6 +29,11 @@ static_assert(sizeof(gint::integer<128, unsigned>) == 16, "integer<128> must occ
 static_assert(sizeof(gint::integer<256, unsigned>) == 32, "integer<256> must occupy exactly 256 bits");
 static_assert(sizeof(gint::integer<512, unsigned>) == 64, "integer<512> must occupy exactly 512 bits");
 static_assert(sizeof(gint::integer<1024, unsigned>) == 128, "integer<1024> must occupy exactly 1024 bits");
+static_assert(sizeof(gint::integer<192, unsigned>) == 24, "integer<192> must occupy exactly 192 bits");
+static_assert(sizeof(gint::integer<320, signed>) == 40, "integer<320> must occupy exactly 320 bits");
+static_assert(sizeof(gint::integer<448, unsigned>) == 56, "integer<448> must occupy exactly 448 bits");
+static_assert(sizeof(gint::integer<2048, unsigned>) == 256, "integer<2048> must occupy exactly 2048 bits");
+static_assert(sizeof(gint::integer<4096, signed>) == 512, "integer<4096> must occupy exactly 4096 bits");
 
 TEST(WideIntegerConstruction, ConstexprConstruction)
 {
@@ -67,3 +72,22 @@ TEST(WideIntegerConstruction, DefaultCopyMove)
     e = std::move(d);
     EXPECT_EQ(e, U256(0));
 }
+
+#if __cplusplus >= 201402L
+TEST(WideIntegerConstruction, Literals)
+{
+    using namespace gint::literals;
+    static_assert(
+        115792089237316195423570985008687907853269984665640564039457584007913129639935_u256 == ~gint::UInt256(0),
+        "decimal literal must reach the type maximum");
+    static_assert(0xFFFFFFFFFFFFFFFF0000000000000001_u128 == ((gint::UInt128(~0ull) << 64) | 1), "hex literal failed");
+    static_assert(0b1010_u256 == 10 && 017_u256 == 15 && 0_u256 == 0, "binary/octal/zero literal failed");
+    static_assert(-170141183460469231731687303715884105727_i128 - 1 == std::numeric_limits<gint::Int128>::min(), "signed minimum");
+    static_assert(0x10000000000000000_u512 == (gint::integer<512, unsigned>(1) << 64), "u512 literal failed");
+    static_assert(-1_i1024 == gint::integer<1024, signed>(-1), "negated i1024 literal failed");
+
+    constexpr auto big = 123456789012345678901234567890123456789012345678901234567890_i256;
+    EXPECT_EQ(big, gint::from_string<gint::Int256>("123456789012345678901234567890123456789012345678901234567890"));
+    EXPECT_EQ(0xdeadbeef_u1024, (gint::integer<1024, unsigned>(0xdeadbeefu)));
+}
+#endif
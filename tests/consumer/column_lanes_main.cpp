@@ -0,0 +1,27 @@
+#include <gint/gint.h>
+
+typedef void (*column_mask_fn)(const gint::column<256, unsigned> &, const gint::column<256, unsigned> &, unsigned char *);
+
+gint::UInt256 column_lanes_avx2_checksum(const gint::column<256, unsigned> & lhs, const gint::column<256, unsigned> & rhs);
+gint::UInt256 column_lanes_scalar_checksum(const gint::column<256, unsigned> & lhs, const gint::column<256, unsigned> & rhs);
+column_mask_fn column_lanes_avx2_less_mask();
+column_mask_fn column_lanes_scalar_less_mask();
+
+// gint::column and gint::integer are the same types in an AVX2 and a baseline
+// translation unit, so functions taking them link across the two. The column
+// kernels differ by lane width and must not share symbols: otherwise the linker
+// keeps one body of each for both translation units.
+int main()
+{
+    gint::UInt256 rows[37];
+    for (unsigned i = 0; i < 37; ++i)
+        rows[i] = (gint::UInt256(0x9E3779B97F4A7C15ULL * (i + 1)) << 190) - i;
+    const gint::column<256, unsigned> lhs(rows, 37);
+    const gint::column<256, unsigned> rhs(37, gint::UInt256(1) << 191);
+    const gint::UInt256 avx2 = column_lanes_avx2_checksum(lhs, rhs);
+    if (avx2 != column_lanes_scalar_checksum(lhs, rhs) || avx2 == 0)
+        return 1;
+    if (column_lanes_avx2_less_mask() == column_lanes_scalar_less_mask())
+        return 2;
+    return 0;
+}
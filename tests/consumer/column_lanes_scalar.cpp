@@ -0,0 +1,27 @@
+#include <gint/gint.h>
+
+// Built for the baseline target and linked with column_lanes_avx2.cpp; see
+// column_lanes_main.cpp.
+typedef void (*column_mask_fn)(const gint::column<256, unsigned> &, const gint::column<256, unsigned> &, unsigned char *);
+
+gint::UInt256 column_lanes_scalar_checksum(const gint::column<256, unsigned> & lhs, const gint::column<256, unsigned> & rhs)
+{
+    unsigned char less[64];
+    less_mask(lhs, rhs, less);
+    const gint::column<256, unsigned> sum = lhs + rhs;
+    gint::integer<320, unsigned> total;
+    gint::reduce_sum(sum, total);
+    gint::UInt256 low;
+    gint::UInt256 high;
+    gint::reduce_min(min(lhs, rhs), low);
+    gint::reduce_max(max(lhs, rhs), high);
+    gint::UInt256 checksum = gint::UInt256(total % 1000003) ^ (low << 7) ^ (high >> 7);
+    for (size_t i = 0; i < lhs.size(); ++i)
+        checksum = checksum * 3 + less[i];
+    return checksum;
+}
+
+column_mask_fn column_lanes_scalar_less_mask()
+{
+    return &gint::less_mask<256, unsigned>;
+}
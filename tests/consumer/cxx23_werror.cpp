@@ -2,6 +2,10 @@
 
 #include <gint/gint.h>
 
+using namespace gint::literals;
+static_assert(0xFFFF'FFFF'0000'0001_u128 == gint::UInt128(0xFFFFFFFF00000001ull), "digit separators in hex literals");
+static_assert(1'000'000_i256 == gint::Int256(1000000), "digit separators in decimal literals");
+
 int main()
 {
     const gint::Int256 value = std::numeric_limits<gint::Int256>::max();
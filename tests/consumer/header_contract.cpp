@@ -5,6 +5,14 @@ static_assert(GINT_VERSION_MINOR == 9, "unexpected gint minor version");
 static_assert(GINT_VERSION_PATCH == 0, "unexpected gint patch version");
 static_assert(GINT_VERSION == 900, "unexpected encoded gint version");
 
+#if defined(GINT_HEADER_CONTRACT_LITERAL_OUT_OF_RANGE)
+using namespace gint::literals;
+const gint::Int128 literal_out_of_range = 170141183460469231731687303715884105728_i128;
+#elif defined(GINT_HEADER_CONTRACT_LITERAL_INVALID_DIGIT)
+using namespace gint::literals;
+const gint::UInt256 literal_invalid_digit = 1.5_u256;
+#endif
+
 int main()
 {
     const gint::UInt128 value = 42;
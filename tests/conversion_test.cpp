@@ -2,8 +2,10 @@
 #include <cfenv>
 #include <cmath>
 #include <limits>
+#include <random>
 #include <sstream>
 #include <type_traits>
+#include <vector>
 #include <gint/gint.h>
 #include <gtest/gtest.h>
 
@@ -233,6 +235,183 @@ TEST(WideIntegerConversion, DoubleConversionRespectsCurrentRoundingMode)
     EXPECT_EQ(static_cast<double>(negative), -(base + 4.0));
 }
 
+namespace
+{
+struct RoundingCase
+{
+    gint::rounding mode;
+    int fenv;
+};
+
+const RoundingCase kRoundingCases[] = {
+    {gint::rounding::to_nearest, FE_TONEAREST},
+    {gint::rounding::upward, FE_UPWARD},
+    {gint::rounding::downward, FE_DOWNWARD},
+    {gint::rounding::toward_zero, FE_TOWARDZERO},
+};
+
+template <typename Float, gint::rounding Mode>
+void expect_matches_native_conversion(int fenv, unsigned __int128 bits)
+{
+    using U128 = gint::integer<128, unsigned>;
+    using S128 = gint::integer<128, signed>;
+    const U128 value = (U128(static_cast<uint64_t>(bits >> 64)) << 64) | U128(static_cast<uint64_t>(bits));
+    ASSERT_EQ(std::fesetround(fenv), 0);
+    const Float unsigned_native = static_cast<Float>(bits);
+    const Float signed_native = static_cast<Float>(static_cast<__int128>(bits));
+    ASSERT_EQ(std::fesetround(FE_TONEAREST), 0);
+    EXPECT_EQ((gint::to_binary_float<Float, Mode>(value)), unsigned_native);
+    EXPECT_EQ((gint::to_binary_float<Float, Mode>(S128(value))), signed_native);
+}
+
+template <typename Float>
+void expect_all_modes_match_native(int fenv, gint::rounding mode, unsigned __int128 bits)
+{
+    switch (mode)
+    {
+        case gint::rounding::to_nearest:
+            expect_matches_native_conversion<Float, gint::rounding::to_nearest>(fenv, bits);
+            break;
+        case gint::rounding::upward:
+            expect_matches_native_conversion<Float, gint::rounding::upward>(fenv, bits);
+            break;
+        case gint::rounding::downward:
+            expect_matches_native_conversion<Float, gint::rounding::downward>(fenv, bits);
+            break;
+        case gint::rounding::toward_zero:
+            expect_matches_native_conversion<Float, gint::rounding::toward_zero>(fenv, bits);
+            break;
+    }
+}
+} // namespace
+
+TEST(WideIntegerConversion, CompileTimeRoundingMatchesNativeConversion)
+{
+    struct RoundingGuard
+    {
+        int old_round;
+        RoundingGuard()
+            : old_round(std::fegetround())
+        {
+        }
+        ~RoundingGuard() { std::fesetround(old_round); }
+    } guard;
+
+    // Random lengths, plus significands followed by an exact half, just
+    // under it and just over it.
+    std::mt19937_64 rng(41);
+    for (int i = 0; i < 2000; ++i)
+    {
+        unsigned __int128 bits = (static_cast<unsigned __int128>(rng()) << 64) | rng();
+        bits >>= rng() % 128;
+        if (i % 4 == 1)
+            bits = (bits | 1) << 70 | (static_cast<unsigned __int128>(1) << 69);
+        else if (i % 4 == 2)
+            bits = ((bits | 1) << 40) + (static_cast<unsigned __int128>(1) << 10) - (i % 8 == 2 ? 1 : -1);
+        for (const RoundingCase & rounding : kRoundingCases)
+        {
+            expect_all_modes_match_native<double>(rounding.fenv, rounding.mode, bits);
+            expect_all_modes_match_native<float>(rounding.fenv, rounding.mode, bits);
+        }
+    }
+}
+
+TEST(WideIntegerConversion, CompileTimeRoundingOverflowAndBatch)
+{
+    const gint::UInt256 big = ~gint::UInt256(0);
+    const gint::Int256 negative = -gint::Int256(big >> 1);
+    const float maximum = std::numeric_limits<float>::max();
+    const float infinity = std::numeric_limits<float>::infinity();
+    EXPECT_EQ((gint::to_binary_float<float>(big)), infinity);
+    EXPECT_EQ((gint::to_binary_float<float, gint::rounding::toward_zero>(big)), maximum);
+    EXPECT_EQ((gint::to_binary_float<float, gint::rounding::upward>(negative)), -maximum);
+    EXPECT_EQ((gint::to_binary_float<float, gint::rounding::downward>(negative)), -infinity);
+    EXPECT_EQ((gint::to_binary_float<double, gint::rounding::upward>(big)), std::ldexp(1.0, 256));
+    EXPECT_EQ((gint::to_binary_float<double>(gint::Int256(0))), 0.0);
+
+    using Int4096 = gint::integer<4096, signed>;
+    EXPECT_EQ((gint::to_binary_float<double>(std::numeric_limits<Int4096>::max())), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(
+        (gint::to_binary_float<double, gint::rounding::toward_zero>(std::numeric_limits<Int4096>::min())),
+        -std::numeric_limits<double>::max());
+
+    const gint::Int256 values[] = {gint::Int256(3), -gint::Int256(1) << 200, gint::Int256(big >> 3), gint::Int256(-7)};
+    double out[4];
+    gint::to_double<gint::rounding::downward>(values, 4, out);
+    for (size_t i = 0; i < 4; ++i)
+        EXPECT_EQ(out[i], (gint::to_binary_float<double, gint::rounding::downward>(values[i])));
+}
+
+namespace
+{
+// integer(v) rebuilt from frexp: the 64-bit integer significand shifted by
+// the remaining exponent, negated afterwards so high bits wrap the same way.
+template <typename Int, typename Float>
+Int decomposed_float(Float v)
+{
+    int exponent = 0;
+    const Float fraction = std::frexp(std::fabs(v), &exponent);
+    const int digits = std::numeric_limits<Float>::digits;
+    const uint64_t significand = static_cast<uint64_t>(std::ldexp(fraction, digits));
+    const int shift = exponent - digits;
+    Int magnitude = 0;
+    if (shift <= -digits)
+        magnitude = 0;
+    else if (shift < 0)
+        magnitude = Int(significand >> -shift);
+    else if (shift < static_cast<int>(Int::bits))
+        magnitude = Int(significand) << shift;
+    return v < 0 ? Int(-magnitude) : magnitude;
+}
+
+template <typename Int, typename Float>
+void expect_float_construction_matches(uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<Float> values;
+    for (int i = 0; i < 3000; ++i)
+    {
+        const Float mantissa = static_cast<Float>(static_cast<int64_t>(rng())) / static_cast<Float>(1ull << 63);
+        const Float value = std::ldexp(mantissa, static_cast<int>(rng() % (Int::bits + 80)) - 20);
+        if (std::isfinite(value))
+            values.push_back(value);
+    }
+    for (const Float v : values)
+        EXPECT_EQ(Int(v), (decomposed_float<Int, Float>(v))) << v;
+}
+} // namespace
+
+TEST(WideIntegerConversion, FloatConstructionMatchesDecomposition)
+{
+    expect_float_construction_matches<gint::Int256, double>(1);
+    expect_float_construction_matches<gint::UInt256, double>(2);
+    expect_float_construction_matches<gint::Int128, float>(3);
+    expect_float_construction_matches<gint::integer<512, unsigned>, float>(4);
+
+    using S256 = gint::Int256;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    const double values[] = {
+        0.0, -0.0, 0.75, -0.999, std::numeric_limits<double>::denorm_min(), nan, inf, -inf, std::ldexp(1.0, 255), std::ldexp(-3.0, 300)};
+    const S256 expected[] = {
+        S256(0),
+        S256(0),
+        S256(0),
+        S256(0),
+        S256(0),
+        S256(0),
+        std::numeric_limits<S256>::max(),
+        std::numeric_limits<S256>::min(),
+        std::numeric_limits<S256>::min(),
+        S256(0)};
+    S256 out[10];
+    gint::from_double(values, 10, out);
+    for (size_t i = 0; i < 10; ++i)
+        EXPECT_EQ(out[i], expected[i]) << i;
+    EXPECT_EQ(gint::UInt256(-inf), gint::UInt256(0));
+    EXPECT_EQ(gint::UInt256(-2.0), ~gint::UInt256(0) - gint::UInt256(1));
+}
+
 TEST(WideIntegerConversion, FloatConversionAvoidsLongDoubleDoubleRounding)
 {
     using U128 = gint::integer<128, unsigned>;
@@ -416,6 +595,23 @@ TEST(WideIntegerConversion, FromStringPrefixesAndBases)
     EXPECT_EQ(gint::from_string<gint::UInt128>("0xff", 16), gint::UInt128(255));
 }
 
+#if __cplusplus >= 201402L && defined(__has_builtin)
+#    if __has_builtin(__builtin_is_constant_evaluated)
+TEST(WideIntegerConversion, FromStringIsConstexpr)
+{
+    constexpr auto max_u128 = gint::from_string<gint::UInt128>("340282366920938463463374607431768211455");
+    static_assert(max_u128 == std::numeric_limits<gint::UInt128>::max(), "decimal");
+    static_assert(
+        gint::from_string<128, signed>("-170141183460469231731687303715884105728") == std::numeric_limits<gint::Int128>::min(),
+        "signed decimal");
+    static_assert(gint::from_string<gint::UInt128>("0b101010") == 42 && gint::from_string<gint::UInt128>("0107") == 71, "prefixes");
+    static_assert(gint::from_string<gint::UInt256>("0xff", 16) == 255 && gint::from_string<gint::UInt256>("zz", 36) == 1295, "bases");
+    static_assert(gint::from_string<gint::UInt128>("340282366920938463463374607431768211456") == 0, "wraps");
+    EXPECT_EQ(max_u128, gint::from_string<gint::UInt128>(std::string("340282366920938463463374607431768211455")));
+}
+#    endif
+#endif
+
 TEST(WideIntegerConversion, FromStringWrapsToFixedWidth)
 {
     EXPECT_EQ(gint::from_string<gint::UInt128>("340282366920938463463374607431768211456"), gint::UInt128(0));
@@ -347,6 +347,204 @@ inline void exercise_division(const uint8_t * data, size_t size)
         make_signed_reference(ref_signed_divisor_magnitude, divisor_negative));
 }
 
+// Non-power-of-two widths (192/320/384/448 bits) reuse the same bitwise
+// division oracle through a limb-count template.
+template <size_t Limbs>
+struct limbs_reference
+{
+    uint64_t limbs[Limbs];
+
+    limbs_reference()
+        : limbs()
+    {
+    }
+};
+
+template <size_t Limbs>
+bool reference_is_zero(const limbs_reference<Limbs> & value)
+{
+    uint64_t any = 0;
+    for (size_t i = 0; i < Limbs; ++i)
+        any |= value.limbs[i];
+    return any == 0;
+}
+
+template <size_t Limbs>
+limbs_reference<Limbs> reference_add(const limbs_reference<Limbs> & lhs, const limbs_reference<Limbs> & rhs)
+{
+    limbs_reference<Limbs> result;
+    uint128_t carry = 0;
+    for (size_t i = 0; i < Limbs; ++i)
+    {
+        carry += static_cast<uint128_t>(lhs.limbs[i]) + rhs.limbs[i];
+        result.limbs[i] = static_cast<uint64_t>(carry);
+        carry >>= 64;
+    }
+    return result;
+}
+
+template <size_t Limbs>
+limbs_reference<Limbs> reference_subtract(const limbs_reference<Limbs> & lhs, const limbs_reference<Limbs> & rhs)
+{
+    limbs_reference<Limbs> result;
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < Limbs; ++i)
+    {
+        const uint128_t subtrahend = static_cast<uint128_t>(rhs.limbs[i]) + borrow;
+        result.limbs[i] = lhs.limbs[i] - static_cast<uint64_t>(subtrahend);
+        borrow = static_cast<uint128_t>(lhs.limbs[i]) < subtrahend;
+    }
+    return result;
+}
+
+template <size_t Limbs>
+void reference_negate(limbs_reference<Limbs> & value)
+{
+    value = reference_subtract(limbs_reference<Limbs>(), value);
+}
+
+template <size_t Limbs>
+limbs_reference<Limbs> reference_multiply(const limbs_reference<Limbs> & lhs, const limbs_reference<Limbs> & rhs)
+{
+    limbs_reference<Limbs> result;
+    for (size_t i = 0; i < Limbs; ++i)
+    {
+        uint128_t carry = 0;
+        for (size_t j = 0; i + j < Limbs; ++j)
+        {
+            carry += static_cast<uint128_t>(lhs.limbs[i]) * rhs.limbs[j] + result.limbs[i + j];
+            result.limbs[i + j] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+    }
+    return result;
+}
+
+template <size_t Limbs>
+struct limbs_divmod_result
+{
+    limbs_reference<Limbs> quotient;
+    limbs_reference<Limbs> remainder;
+};
+
+template <size_t Limbs>
+limbs_divmod_result<Limbs> reference_divmod(const limbs_reference<Limbs> & dividend, const limbs_reference<Limbs> & divisor)
+{
+    require(!reference_is_zero(divisor), "reference division by zero");
+    limbs_divmod_result<Limbs> result;
+    for (size_t bit = Limbs * 64; bit-- > 0;)
+    {
+        const bool carry = (result.remainder.limbs[Limbs - 1] >> 63) != 0;
+        for (size_t i = Limbs; i-- > 1;)
+            result.remainder.limbs[i] = (result.remainder.limbs[i] << 1) | (result.remainder.limbs[i - 1] >> 63);
+        result.remainder.limbs[0] = (result.remainder.limbs[0] << 1) | ((dividend.limbs[bit / 64] >> (bit % 64)) & 1u);
+
+        int compare = 0;
+        for (size_t i = Limbs; compare == 0 && i-- > 0;)
+            compare = result.remainder.limbs[i] < divisor.limbs[i] ? -1 : result.remainder.limbs[i] > divisor.limbs[i] ? 1 : 0;
+        if (carry || compare >= 0)
+        {
+            result.remainder = reference_subtract(result.remainder, divisor);
+            result.quotient.limbs[bit / 64] |= uint64_t(1) << (bit % 64);
+        }
+    }
+    return result;
+}
+
+template <size_t Limbs>
+limbs_reference<Limbs> limbs_reference_from_input(const uint8_t * data, size_t size, size_t offset, size_t byte_count)
+{
+    limbs_reference<Limbs> value;
+    for (size_t i = 0; i < byte_count; ++i)
+        value.limbs[i / 8] |= uint64_t(input_byte(data, size, offset + i)) << ((i % 8) * 8);
+    return value;
+}
+
+template <size_t Bits, typename Signed>
+bool equal_bits(const gint::integer<Bits, Signed> & actual, const limbs_reference<Bits / 64> & expected)
+{
+    for (size_t limb = 0; limb < Bits / 64; ++limb)
+    {
+        if (gint_integer_access<gint::integer<Bits, Signed>>::limb(actual, limb) != expected.limbs[limb])
+            return false;
+    }
+    return true;
+}
+
+template <size_t Bits, typename Signed>
+gint::integer<Bits, Signed> gint_from_reference(const limbs_reference<Bits / 64> & value)
+{
+    gint::integer<Bits, Signed> result;
+    for (size_t limb = 0; limb < Bits / 64; ++limb)
+        gint_integer_access<gint::integer<Bits, Signed>>::limb(result, limb) = value.limbs[limb];
+    return result;
+}
+
+template <size_t Bits>
+void exercise_width(const uint8_t * data, size_t size)
+{
+    static const size_t limbs = Bits / 64;
+    using UInt = gint::integer<Bits, unsigned>;
+    using Int = gint::integer<Bits, signed>;
+    using reference = limbs_reference<limbs>;
+
+    const uint8_t control = input_byte(data, size, 1);
+    const size_t divisor_bytes = (control & 3u) == 1u ? 8u : (control & 3u) == 2u ? 16u : (control & 3u) == 3u ? limbs * 4 : limbs * 8;
+    const reference lhs = limbs_reference_from_input<limbs>(data, size, 2, limbs * 8);
+    reference rhs = limbs_reference_from_input<limbs>(data, size, 2 + limbs * 8, divisor_bytes);
+    if (reference_is_zero(rhs))
+        rhs.limbs[0] = 1;
+    const UInt a = gint_from_reference<Bits, unsigned>(lhs);
+    const UInt b = gint_from_reference<Bits, unsigned>(rhs);
+
+    require(equal_bits(UInt(a + b), reference_add(lhs, rhs)), "extended-width addition differs from limb oracle");
+    require(equal_bits(UInt(a - b), reference_subtract(lhs, rhs)), "extended-width subtraction differs from limb oracle");
+    require(equal_bits(UInt(a * b), reference_multiply(lhs, rhs)), "extended-width multiplication differs from limb oracle");
+
+    const limbs_divmod_result<limbs> expected = reference_divmod(lhs, rhs);
+    const gint::divmod_result<UInt> result = gint::divmod(a, b);
+    require(equal_bits(result.quotient, expected.quotient), "extended-width unsigned quotient differs from bitwise oracle");
+    require(equal_bits(result.remainder, expected.remainder), "extended-width unsigned remainder differs from bitwise oracle");
+    require(result.quotient == a / b && result.remainder == a % b, "extended-width divmod differs from operator/ and operator%");
+
+    // Signed division: clear the top bits so both magnitudes are representable, then apply the control signs.
+    reference lhs_magnitude = lhs;
+    reference rhs_magnitude = rhs;
+    lhs_magnitude.limbs[limbs - 1] &= ~(uint64_t(1) << 63);
+    rhs_magnitude.limbs[limbs - 1] &= ~(uint64_t(1) << 63);
+    if (reference_is_zero(rhs_magnitude))
+        rhs_magnitude.limbs[0] = 1;
+    const bool lhs_negative = (control & 0x10u) != 0;
+    const bool rhs_negative = (control & 0x20u) != 0;
+    const limbs_divmod_result<limbs> magnitudes = reference_divmod(lhs_magnitude, rhs_magnitude);
+    reference expected_quotient = magnitudes.quotient;
+    reference expected_remainder = magnitudes.remainder;
+    if (lhs_negative != rhs_negative)
+        reference_negate(expected_quotient);
+    if (lhs_negative)
+        reference_negate(expected_remainder);
+    Int dividend = gint_from_reference<Bits, signed>(lhs_magnitude);
+    Int divisor = gint_from_reference<Bits, signed>(rhs_magnitude);
+    if (lhs_negative)
+        dividend = -dividend;
+    if (rhs_negative)
+        divisor = -divisor;
+    const gint::divmod_result<Int> signed_result = gint::divmod(dividend, divisor);
+    require(equal_bits(signed_result.quotient, expected_quotient), "extended-width signed quotient differs from bitwise oracle");
+    require(equal_bits(signed_result.remainder, expected_remainder), "extended-width signed remainder differs from bitwise oracle");
+    require(signed_result.quotient * divisor + signed_result.remainder == dividend, "extended-width signed division identity failed");
+}
+
+inline void exercise_extended_widths(const uint8_t * data, size_t size)
+{
+    exercise_width<192>(data, size);
+    exercise_width<320>(data, size);
+    exercise_width<384>(data, size);
+    exercise_width<448>(data, size);
+    exercise_width<2048>(data, size);
+    exercise_width<4096>(data, size);
+}
+
 inline unsigned reference_digit_value(char character)
 {
     const unsigned value = static_cast<unsigned>(static_cast<unsigned char>(character));
@@ -800,6 +998,7 @@ inline void exercise_input(const uint8_t * data, size_t size)
     {
         case 0:
             exercise_division(data, size);
+            exercise_extended_widths(data, size);
             break;
         case 1:
             exercise_parser(data, size);
@@ -0,0 +1,131 @@
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+
+#include "random_limbs.h"
+
+// Built with GINT_ENABLE_DIVISION_CACHE; the division suites in
+// arithmetic_divmod_test.cpp and property_test.cpp run against the same cache.
+namespace
+{
+
+// Between one and max_limbs random limbs, negated a third of the time.
+template <typename Int>
+Int random_operand(std::mt19937_64 & rng, size_t max_limbs)
+{
+    const Int value = gint_test::random_limbs<Int>(rng, 1 + static_cast<size_t>(rng() % max_limbs));
+    return rng() % 3 == 0 ? -value : value;
+}
+
+template <typename Int>
+void expect_division_identity(const Int & x, const Int & y)
+{
+    const Int q = x / y;
+    const Int r = x % y;
+    EXPECT_EQ(q * y + r, x);
+    using Unsigned = gint::integer<Int::bits, unsigned>;
+    EXPECT_TRUE(Unsigned(r < 0 ? -r : r) < Unsigned(y < 0 ? -y : y));
+    EXPECT_TRUE(r == 0 || (r < 0) == (x < 0));
+}
+
+template <typename Int>
+void check_repeated_divisors(uint64_t seed)
+{
+    constexpr size_t limbs = Int::bits / 64;
+    std::mt19937_64 rng(seed);
+    for (int round = 0; round < 200; ++round)
+    {
+        // A few divisors reused across many dividends, more than the cache holds.
+        Int divisors[6];
+        for (Int & d : divisors)
+        {
+            d = random_operand<Int>(rng, limbs);
+            if (d == 0)
+                d = 3;
+        }
+        for (int i = 0; i < 40; ++i)
+            expect_division_identity(random_operand<Int>(rng, limbs), divisors[rng() % (i < 20 ? 2 : 6)]);
+    }
+}
+
+} // namespace
+
+TEST(DivisionCache, RepeatedDivisorsKeepResults)
+{
+    check_repeated_divisors<gint::integer<192, unsigned>>(1);
+    check_repeated_divisors<gint::Int256>(2);
+    check_repeated_divisors<gint::UInt256>(3);
+    check_repeated_divisors<gint::integer<512, signed>>(4);
+    check_repeated_divisors<gint::integer<1024, unsigned>>(5);
+    check_repeated_divisors<gint::integer<2048, signed>>(6);
+}
+
+TEST(DivisionCache, SignedEdgeValues)
+{
+    const gint::Int256 min = std::numeric_limits<gint::Int256>::min();
+    const gint::Int256 max = std::numeric_limits<gint::Int256>::max();
+    const gint::Int256 divisor = (gint::Int256(1) << 130) + 12345;
+    for (int i = 0; i < 2; ++i)
+    {
+        expect_division_identity(min, divisor);
+        expect_division_identity(min, -divisor);
+        expect_division_identity(max, -divisor);
+        expect_division_identity(max, min);
+        EXPECT_EQ(min / min, 1);
+        EXPECT_EQ(min % min, 0);
+    }
+    EXPECT_EQ((gint::Int256(5) / divisor), 0);
+    EXPECT_EQ((gint::Int256(-5) % divisor), -5);
+    EXPECT_EQ((gint::UInt256(1) << 200) / (gint::UInt256(1) << 100), gint::UInt256(1) << 100);
+}
+
+TEST(DivisionCache, CountsHitsAndMisses)
+{
+    const gint::UInt256 divisor = (gint::UInt256(7) << 64) + 11;
+    const gint::UInt256 dividend = ~gint::UInt256(0);
+    gint::reset_division_cache_statistics();
+    const gint::UInt256 q = dividend / divisor;
+    const gint::UInt256 r = dividend % divisor;
+    EXPECT_EQ(q * divisor + r, dividend);
+    EXPECT_EQ((dividend - 1) / divisor, q);
+    gint::division_cache_stats stats = gint::division_cache_statistics();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+
+    // Single-limb and power-of-two divisors, dividends no wider than the
+    // divisor and 256-bit divisions with a two-limb quotient keep their own
+    // paths.
+    gint::reset_division_cache_statistics();
+    const gint::UInt256 three_limb = (gint::UInt256(7) << 128) + 11;
+    EXPECT_EQ(dividend / three_limb * three_limb + dividend % three_limb, dividend);
+    EXPECT_EQ(dividend / gint::UInt256(1000000007) * 1000000007u + dividend % gint::UInt256(1000000007), dividend);
+    EXPECT_EQ(dividend / (gint::UInt256(1) << 150), dividend >> 150);
+    EXPECT_EQ(dividend % (gint::UInt256(1) << 150), dividend & ((gint::UInt256(1) << 150) - 1));
+    EXPECT_EQ(dividend / (dividend >> 1), 2);
+    EXPECT_EQ(divisor % dividend, divisor);
+    stats = gint::division_cache_statistics();
+    EXPECT_EQ(stats.hits + stats.misses, 0u);
+}
+
+TEST(DivisionCache, CountersArePerThread)
+{
+    const gint::Int256 divisor = (gint::Int256(3) << 64) + 1;
+    gint::reset_division_cache_statistics();
+    gint::Int256 sum = 0;
+    gint::division_cache_stats other = {0, 0};
+    std::thread worker(
+        [&]
+        {
+            for (int i = 1; i <= 10; ++i)
+                sum += (gint::Int256(i) << 200) / divisor;
+            other = gint::division_cache_statistics();
+        });
+    worker.join();
+    EXPECT_GT(sum, 0);
+    EXPECT_EQ(other.misses, 1u);
+    EXPECT_EQ(other.hits, 9u);
+    const gint::division_cache_stats self = gint::division_cache_statistics();
+    EXPECT_EQ(self.hits + self.misses, 0u);
+}
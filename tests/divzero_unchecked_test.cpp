@@ -66,6 +66,12 @@ TEST(WideIntegerDivModUnchecked, ScalarZeroDivisor)
     const std::int64_t i64_zero = 0;
     EXPECT_EQ(s / i64_zero, S512(0));
     EXPECT_EQ(s % i64_zero, s);
+
+    using S128 = gint::integer<128, signed>;
+    const unsigned __int128 out_of_range = ~static_cast<unsigned __int128>(0);
+    const S128 s128_zero = 0;
+    EXPECT_EQ(out_of_range / s128_zero, S128(0));
+    EXPECT_EQ(out_of_range % s128_zero, S128(out_of_range));
 }
 
 TEST(WideIntegerDivModUnchecked, FloatingZeroDivisor)
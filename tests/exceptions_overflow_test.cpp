@@ -23,6 +23,11 @@ TEST(WideIntegerDivMod, ZeroDivisor)
     S256 szero = 0;
     EXPECT_THROW(sval / szero, std::domain_error);
     EXPECT_THROW(sval % szero, std::domain_error);
+
+    using S128 = gint::integer<128, signed>;
+    const unsigned __int128 out_of_range = ~static_cast<unsigned __int128>(0);
+    EXPECT_THROW(out_of_range / S128(0), std::domain_error);
+    EXPECT_THROW(out_of_range % S128(0), std::domain_error);
 }
 
 TEST(WideIntegerExceptions, ConstructFromNegative)
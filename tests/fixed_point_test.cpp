@@ -0,0 +1,199 @@
+#include <cmath>
+#include <random>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using Wide = gint::integer<1024, signed>;
+
+const gint::rounding kModes[] = {gint::rounding::toward_zero, gint::rounding::to_nearest, gint::rounding::downward, gint::rounding::upward};
+
+template <typename Reference>
+Reference abs_wide(const Reference & value)
+{
+    return value < Reference(0) ? -value : value;
+}
+
+// Exact numerator / denominator rounded with mode, computed in a wider type.
+template <typename Reference>
+Reference rounded_quotient(const Reference & numerator, const Reference & denominator, gint::rounding mode)
+{
+    Reference quotient = numerator / denominator;
+    const Reference remainder = numerator % denominator;
+    if (remainder == Reference(0))
+        return quotient;
+    const bool negative = (numerator < Reference(0)) != (denominator < Reference(0));
+    const Reference step = negative ? Reference(-1) : Reference(1);
+    const Reference twice = abs_wide(remainder) * Reference(2);
+    const Reference divisor = abs_wide(denominator);
+    switch (mode)
+    {
+        case gint::rounding::toward_zero:
+            break;
+        case gint::rounding::to_nearest:
+            if (twice > divisor || (twice == divisor && (quotient & Reference(1)) != Reference(0)))
+                quotient += step;
+            break;
+        case gint::rounding::downward:
+            if (negative)
+                quotient -= Reference(1);
+            break;
+        case gint::rounding::upward:
+            if (!negative)
+                quotient += Reference(1);
+            break;
+    }
+    return quotient;
+}
+
+template <typename Fixed>
+typename Fixed::raw_type random_raw(std::mt19937_64 & rng)
+{
+    using Raw = typename Fixed::raw_type;
+    Raw value = 0;
+    for (size_t i = 0; i < Raw::limbs; ++i)
+        value = (value << 64) | Raw(rng());
+    return value >> static_cast<int>(rng() % Fixed::bits);
+}
+
+template <typename Fixed, typename Reference = Wide>
+void expect_fixed_matches_reference(uint64_t seed, int iterations = 300)
+{
+    using Raw = typename Fixed::raw_type;
+    std::mt19937_64 rng(seed);
+    const Reference one_unit = Reference(1) << static_cast<int>(Fixed::frac_bits);
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        const Fixed lhs = Fixed::from_raw(random_raw<Fixed>(rng));
+        const Fixed rhs = Fixed::from_raw(random_raw<Fixed>(rng));
+        const Reference a = Reference(lhs.raw());
+        const Reference b = Reference(rhs.raw());
+        for (const gint::rounding mode : kModes)
+        {
+            Raw expected = Raw(rounded_quotient(a * b, one_unit, mode));
+            Fixed product;
+            switch (mode)
+            {
+                case gint::rounding::toward_zero:
+                    product = gint::mul<gint::rounding::toward_zero>(lhs, rhs);
+                    break;
+                case gint::rounding::to_nearest:
+                    product = gint::mul<gint::rounding::to_nearest>(lhs, rhs);
+                    break;
+                case gint::rounding::downward:
+                    product = gint::mul<gint::rounding::downward>(lhs, rhs);
+                    break;
+                case gint::rounding::upward:
+                    product = gint::mul<gint::rounding::upward>(lhs, rhs);
+                    break;
+            }
+            EXPECT_EQ(product.raw(), expected) << "mul mode " << static_cast<int>(mode);
+
+            if (b == Reference(0))
+                continue;
+            expected = Raw(rounded_quotient(a * one_unit, b, mode));
+            Fixed quotient;
+            switch (mode)
+            {
+                case gint::rounding::toward_zero:
+                    quotient = gint::div<gint::rounding::toward_zero>(lhs, rhs);
+                    break;
+                case gint::rounding::to_nearest:
+                    quotient = gint::div<gint::rounding::to_nearest>(lhs, rhs);
+                    break;
+                case gint::rounding::downward:
+                    quotient = gint::div<gint::rounding::downward>(lhs, rhs);
+                    break;
+                case gint::rounding::upward:
+                    quotient = gint::div<gint::rounding::upward>(lhs, rhs);
+                    break;
+            }
+            EXPECT_EQ(quotient.raw(), expected) << "div mode " << static_cast<int>(mode);
+        }
+        EXPECT_EQ(lhs * rhs, gint::mul<gint::rounding::toward_zero>(lhs, rhs));
+        if (b != Reference(0))
+        {
+            EXPECT_EQ(lhs / rhs, gint::div<gint::rounding::toward_zero>(lhs, rhs));
+        }
+    }
+}
+} // namespace
+
+TEST(FixedPoint, MulDivMatchWideReference)
+{
+    expect_fixed_matches_reference<gint::fixed<64, 32>>(1);
+    expect_fixed_matches_reference<gint::fixed<64, 63, unsigned>>(2);
+    expect_fixed_matches_reference<gint::fixed<128, 0>>(3);
+    expect_fixed_matches_reference<gint::fixed<128, 64, unsigned>>(4);
+    expect_fixed_matches_reference<gint::fixed<256, 128>>(5);
+    expect_fixed_matches_reference<gint::fixed<256, 96, unsigned>>(6);
+    expect_fixed_matches_reference<gint::fixed<256, 200>>(7);
+    // Full products from 2048 bits up take the Karatsuba kernel.
+    expect_fixed_matches_reference<gint::fixed<2048, 1024>, gint::integer<4096, signed>>(8, 40);
+    expect_fixed_matches_reference<gint::fixed<2048, 700, unsigned>, gint::integer<4096, signed>>(9, 40);
+}
+
+TEST(FixedPoint, ArithmeticAndComparison)
+{
+    using Q = gint::fixed<256, 128>;
+    const Q three = 3;
+    const Q half = Q::from_raw(Q::raw_type(1) << 127);
+    EXPECT_EQ(three * half, Q::from_raw(Q::raw_type(3) << 127));
+    EXPECT_EQ(three / half, Q(6));
+    EXPECT_EQ(three + half - half, three);
+    EXPECT_EQ(-three * half, -(three * half));
+    EXPECT_TRUE(half < three);
+    EXPECT_TRUE(-three < half);
+    EXPECT_TRUE(three >= three);
+    EXPECT_NE(three, half);
+
+    Q value = 10;
+    value *= half;
+    value /= Q(5);
+    value += Q(1);
+    value -= half;
+    EXPECT_EQ(value, Q(3) / Q(2));
+    EXPECT_EQ(Q(-7) / Q(2), Q::from_raw(-(Q::raw_type(7) << 127)));
+    EXPECT_EQ(gint::div<gint::rounding::downward>(Q(-1), Q(3)) + gint::div<gint::rounding::upward>(Q(1), Q(3)), Q(0));
+}
+
+TEST(FixedPoint, FloatConversionRounding)
+{
+    using Q = gint::fixed<128, 1>;
+    EXPECT_EQ(Q::from_float<gint::rounding::toward_zero>(2.75).raw(), Q::raw_type(5));
+    EXPECT_EQ(Q::from_float<gint::rounding::to_nearest>(2.75).raw(), Q::raw_type(6));
+    EXPECT_EQ(Q::from_float<gint::rounding::to_nearest>(2.25).raw(), Q::raw_type(4));
+    EXPECT_EQ(Q::from_float<gint::rounding::downward>(2.75).raw(), Q::raw_type(5));
+    EXPECT_EQ(Q::from_float<gint::rounding::upward>(2.75).raw(), Q::raw_type(6));
+    EXPECT_EQ(Q::from_float<gint::rounding::toward_zero>(-2.75).raw(), Q::raw_type(-5));
+    EXPECT_EQ(Q::from_float<gint::rounding::to_nearest>(-2.75).raw(), Q::raw_type(-6));
+    EXPECT_EQ(Q::from_float<gint::rounding::downward>(-2.75).raw(), Q::raw_type(-6));
+    EXPECT_EQ(Q::from_float<gint::rounding::upward>(-2.75).raw(), Q::raw_type(-5));
+    EXPECT_EQ(Q::from_float<gint::rounding::to_nearest>(-2.6f).raw(), Q::raw_type(-5));
+    EXPECT_EQ(Q(-2.75).raw(), Q::raw_type(-5));
+    EXPECT_EQ(Q(std::nan("")).raw(), Q::raw_type(0));
+
+    using Q128 = gint::fixed<256, 128>;
+    std::mt19937_64 rng(9);
+    for (int i = 0; i < 200; ++i)
+    {
+        const double value = std::ldexp(static_cast<double>(static_cast<int64_t>(rng())), static_cast<int>(rng() % 120) - 128);
+        EXPECT_EQ(static_cast<double>(Q128(value)), value);
+        EXPECT_EQ(Q128(value).to_float<long double>(), static_cast<long double>(value));
+    }
+    EXPECT_EQ(static_cast<double>(Q128(3) / Q128(4)), 0.75);
+    EXPECT_EQ(static_cast<float>(gint::fixed<64, 32, unsigned>(12)), 12.0f);
+}
+
+#if __cplusplus >= 201402L
+TEST(FixedPoint, IsConstexpr)
+{
+    using Q = gint::fixed<128, 64>;
+    constexpr Q product = Q(3) * Q::from_raw(Q::raw_type(1) << 63);
+    static_assert(product == Q::from_raw(Q::raw_type(3) << 63), "mul");
+    static_assert(gint::mul<gint::rounding::upward>(Q::from_raw(1), Q::from_raw(1)) == Q::from_raw(1), "mul upward");
+    static_assert(Q(2) - Q(5) < Q(0), "sub");
+    EXPECT_EQ(product.raw(), Q::raw_type(3) << 63);
+}
+#endif
@@ -0,0 +1,155 @@
+#include <random>
+#include <vector>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include "random_limbs.h"
+
+namespace
+{
+template <typename Int>
+Int random_bits(std::mt19937_64 & rng, size_t bits)
+{
+    return gint_test::random_limbs<Int>(rng) >> static_cast<int>(Int::bits - bits);
+}
+
+// Signed values that fit in StoredBits, drawn from both signs.
+template <typename Int>
+Int random_signed(std::mt19937_64 & rng, size_t bits)
+{
+    const Int magnitude = random_bits<Int>(rng, bits - 1);
+    return rng() % 2 == 0 ? magnitude : Int(-magnitude - Int(1));
+}
+
+template <size_t StoredBits, typename Int>
+void expect_find_matches_linear_scan(uint64_t seed)
+{
+    using Packed = gint::packed_array<StoredBits, Int>;
+    std::mt19937_64 rng(seed);
+    std::vector<Int> values;
+    Packed packed;
+    for (int i = 0; i < 203; ++i)
+    {
+        // Few distinct values so find and count see repeats; some differ
+        // from a neighbour only in the last stored byte.
+        Int value = random_bits<Int>(rng, StoredBits) & Int(7);
+        if (i % 5 == 0)
+            value |= Int(1) << static_cast<int>(StoredBits - 1);
+        values.push_back(value);
+        packed.push_back(value);
+    }
+    for (int probe = 0; probe < 16; ++probe)
+    {
+        Int needle = values[rng() % values.size()];
+        if (probe % 4 == 0)
+            needle ^= Int(1) << static_cast<int>(StoredBits - 8);
+        const size_t first = rng() % 20;
+        size_t expected = Packed::npos;
+        size_t expected_count = 0;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (values[i] != needle)
+                continue;
+            ++expected_count;
+            if (i >= first && expected == Packed::npos)
+                expected = i;
+        }
+        EXPECT_EQ(packed.find(needle, first), expected);
+        EXPECT_EQ(packed.count(needle), expected_count);
+    }
+}
+} // namespace
+
+TEST(PackedArray, StoresOnlyStoredBytes)
+{
+    gint::packed_array<160, gint::UInt256> addresses(1000);
+    EXPECT_EQ(addresses.size(), 1000u);
+    EXPECT_EQ(addresses.size_bytes(), 20000u);
+    EXPECT_EQ(addresses[999], gint::UInt256(0));
+    EXPECT_EQ((gint::packed_array<96, gint::Int128>::stride), 12u);
+    EXPECT_EQ((gint::packed_array<40, gint::UInt128>::stride), 5u);
+}
+
+TEST(PackedArray, UnsignedRoundTripAndTruncation)
+{
+    using Packed = gint::packed_array<160, gint::UInt256>;
+    std::mt19937_64 rng(1);
+    Packed packed;
+    std::vector<gint::UInt256> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(random_bits<gint::UInt256>(rng, 160));
+        packed.push_back(values.back());
+    }
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(packed[i], values[i]);
+
+    const gint::UInt256 wide = ~gint::UInt256(0);
+    packed.set(3, wide);
+    EXPECT_EQ(packed[3], wide >> 96);
+    EXPECT_EQ(packed[2], values[2]);
+    EXPECT_EQ(packed[4], values[4]);
+}
+
+TEST(PackedArray, SignedElementsSignExtend)
+{
+    std::mt19937_64 rng(2);
+    gint::packed_array<96, gint::Int128> ids;
+    gint::packed_array<40, gint::Int256> small;
+    std::vector<gint::Int128> id_values;
+    std::vector<gint::Int256> small_values;
+    for (int i = 0; i < 100; ++i)
+    {
+        id_values.push_back(random_signed<gint::Int128>(rng, 96));
+        ids.push_back(id_values.back());
+        small_values.push_back(random_signed<gint::Int256>(rng, 40));
+        small.push_back(small_values.back());
+    }
+    for (size_t i = 0; i < id_values.size(); ++i)
+    {
+        EXPECT_EQ(ids[i], id_values[i]);
+        EXPECT_EQ(small[i], small_values[i]);
+    }
+    ids.set(0, gint::Int128(-1));
+    EXPECT_EQ(ids[0], gint::Int128(-1));
+    ids.set(0, (gint::Int128(1) << 95));
+    EXPECT_EQ(ids[0], -(gint::Int128(1) << 95));
+}
+
+TEST(PackedArray, BulkUnpackAndPack)
+{
+    using Packed = gint::packed_array<96, gint::UInt128>;
+    std::mt19937_64 rng(3);
+    Packed packed(50);
+    std::vector<gint::UInt128> source;
+    for (int i = 0; i < 30; ++i)
+        source.push_back(random_bits<gint::UInt128>(rng, 96));
+    packed.pack(10, source.size(), source.data());
+    EXPECT_EQ(packed[9], gint::UInt128(0));
+    EXPECT_EQ(packed[40], gint::UInt128(0));
+
+    std::vector<gint::UInt128> scratch(30);
+    packed.unpack(10, scratch.size(), scratch.data());
+    EXPECT_EQ(scratch, source);
+
+    packed.resize(60);
+    EXPECT_EQ(packed[59], gint::UInt128(0));
+    EXPECT_EQ(packed[39], source.back());
+}
+
+TEST(PackedArray, FindAndCountMatchLinearScan)
+{
+    expect_find_matches_linear_scan<160, gint::UInt256>(4);
+    expect_find_matches_linear_scan<96, gint::UInt128>(5);
+    expect_find_matches_linear_scan<128, gint::UInt256>(6);
+    expect_find_matches_linear_scan<40, gint::UInt128>(7);
+    expect_find_matches_linear_scan<64, gint::UInt128>(8);
+
+    gint::packed_array<160, gint::UInt256> packed(8, gint::UInt256(5));
+    EXPECT_EQ(packed.find(gint::UInt256(5), 8), packed.npos);
+    // The needle is truncated to the stored width like any store.
+    EXPECT_EQ(packed.find(gint::UInt256(5) | (gint::UInt256(1) << 200)), 0u);
+    packed.clear();
+    EXPECT_TRUE(packed.empty());
+    EXPECT_EQ(packed.find(gint::UInt256(5)), packed.npos);
+}
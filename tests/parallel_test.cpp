@@ -0,0 +1,112 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <gint/parallel.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+template <typename Int>
+std::vector<Int> random_values(uint64_t seed, size_t count)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<Int> values(count);
+    for (Int & value : values)
+    {
+        for (size_t i = 0; i < Int::limbs; ++i)
+            value = (value << 64) | Int(rng());
+    }
+    return values;
+}
+} // namespace
+
+// Counts span several chunks with a ragged tail; every thread count must
+// reproduce the serial result exactly.
+TEST(Parallel, MatchesSerialForAnyThreadCount)
+{
+    using Int = gint::Int256;
+    using Wide = gint::integer<320, signed>;
+    const std::vector<Int> values = random_values<Int>(1, 9000);
+    const Int factor = Int(-1000003);
+    const Int divisor = (Int(1) << 130) + Int(17);
+
+    Wide serial_sum = 5;
+    gint::reduce_sum(values.data(), values.size(), serial_sum);
+    std::vector<Int> serial_product(values.size());
+    std::vector<Int> serial_quotient(values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        serial_product[i] = values[i] * factor;
+        serial_quotient[i] = values[i] / divisor;
+    }
+
+    for (unsigned threads : {1u, 2u, 3u, 8u, 0u})
+    {
+        Wide sum = 5;
+        gint::parallel::reduce_sum(values.data(), values.size(), sum, threads);
+        EXPECT_EQ(sum, serial_sum) << threads;
+
+        std::vector<Int> product(values.size());
+        gint::parallel::transform_mul_scalar(values.data(), values.size(), factor, product.data(), threads);
+        EXPECT_EQ(product, serial_product) << threads;
+
+        std::vector<Int> quotient = values;
+        gint::parallel::divide_all_by(quotient.data(), quotient.size(), divisor, quotient.data(), threads);
+        EXPECT_EQ(quotient, serial_quotient) << threads;
+    }
+}
+
+TEST(Parallel, ScansMatchSerial)
+{
+    using Int = gint::Int128;
+    const std::vector<Int> values = random_values<Int>(3, 20000);
+    const Int init = Int(-42);
+    std::vector<Int> inclusive(values.size());
+    std::vector<Int> exclusive(values.size());
+    gint::inclusive_scan(values.data(), values.size(), inclusive.data(), init);
+    gint::exclusive_scan(values.data(), values.size(), exclusive.data(), init);
+    for (unsigned threads : {1u, 2u, 5u})
+    {
+        std::vector<Int> out(values.size());
+        gint::parallel::inclusive_scan(values.data(), values.size(), out.data(), init, threads);
+        EXPECT_EQ(out, inclusive) << threads;
+        out = values;
+        gint::parallel::exclusive_scan(out.data(), out.size(), out.data(), init, threads);
+        EXPECT_EQ(out, exclusive) << threads;
+    }
+}
+
+TEST(Parallel, ToCharsAllFillsSlots)
+{
+    using Int = gint::Int128;
+    std::vector<Int> values = random_values<Int>(2, 5000);
+    values[0] = std::numeric_limits<Int>::min();
+    const size_t width = 41;
+    std::vector<char> text(values.size() * width);
+    std::vector<gint::to_chars_result> results(values.size());
+    gint::parallel::to_chars_all(values.data(), values.size(), text.data(), width, results.data(), 4);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(results[i].ec, std::errc()) << i;
+        EXPECT_EQ(std::string(&text[i * width], results[i].ptr), gint::to_string(values[i])) << i;
+    }
+
+    // A slot too small for the value reports it per element.
+    const Int small[] = {Int(7), Int(-12345)};
+    char narrow[8];
+    gint::to_chars_result narrow_results[2];
+    gint::parallel::to_chars_all(small, 2, narrow, 4, narrow_results, 2);
+    EXPECT_EQ(narrow_results[0].ec, std::errc());
+    EXPECT_EQ(narrow_results[0].ptr, narrow + 1);
+    EXPECT_EQ(narrow_results[1].ec, std::errc::value_too_large);
+}
+
+TEST(Parallel, EmptyRange)
+{
+    using Wide = gint::integer<192, unsigned>;
+    Wide sum = 3;
+    gint::parallel::reduce_sum(static_cast<const gint::UInt128 *>(nullptr), 0, sum, 4);
+    EXPECT_EQ(sum, Wide(3));
+    gint::parallel::transform_mul_scalar(
+        static_cast<const gint::UInt128 *>(nullptr), 0, gint::UInt128(2), static_cast<gint::UInt128 *>(nullptr), 4);
+}
@@ -0,0 +1,138 @@
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+// Built with GINT_ENABLE_PATH_STATS; the division and stream suites in
+// arithmetic_divmod_test.cpp and stream_test.cpp run with the counters on.
+namespace
+{
+
+// Sum of the division kernel counters, for checking that one operation takes
+// exactly one kernel.
+uint64_t division_entries(const gint::stats::counters & c)
+{
+    return c.power_of_two + c.single_limb + c.int128 + c.two_limb + c.three_limb + c.four_limb + c.single_quotient_limb + c.knuth
+        + c.reciprocal + c.cached + c.promoted;
+}
+
+template <typename Int>
+Int value_of_limbs(size_t limbs)
+{
+    Int value = 0;
+    for (size_t i = 0; i < limbs; ++i)
+        value = (value << 64) | Int(0x9E3779B97F4A7C15ULL + i);
+    return value;
+}
+
+} // namespace
+
+TEST(PathStats, CountsDivisionKernels)
+{
+    const gint::UInt256 dividend = value_of_limbs<gint::UInt256>(4);
+
+    gint::stats::reset();
+    EXPECT_EQ(dividend / (gint::UInt256(1) << 150), dividend >> 150);
+    gint::stats::counters c = gint::stats::snapshot();
+    EXPECT_EQ(c.power_of_two, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+
+    gint::stats::reset();
+    EXPECT_NE(value_of_limbs<gint::UInt256>(3) / value_of_limbs<gint::UInt256>(2), 0);
+    c = gint::stats::snapshot();
+    EXPECT_EQ(c.two_limb, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+
+    // A quotient of three or more limbs takes the reciprocal loop at any width.
+    gint::stats::reset();
+    EXPECT_NE(dividend / value_of_limbs<gint::UInt256>(2), 0);
+    c = gint::stats::snapshot();
+    EXPECT_EQ(c.reciprocal, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+
+    gint::stats::reset();
+    EXPECT_NE(dividend / value_of_limbs<gint::UInt256>(3), 0);
+    c = gint::stats::snapshot();
+    EXPECT_EQ(c.three_limb, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+
+    gint::stats::reset();
+    EXPECT_EQ(dividend / gint::UInt256(7) * 7u + dividend % gint::UInt256(7), dividend);
+    EXPECT_EQ(gint::stats::snapshot().single_limb, 2u);
+
+    gint::stats::reset();
+    const gint::Int128 wide = value_of_limbs<gint::Int128>(2) >> 4;
+    EXPECT_EQ(wide * 8 / wide, 8);
+    EXPECT_EQ(gint::stats::snapshot().int128, 1u);
+
+    using UInt1024 = gint::integer<1024, unsigned>;
+    gint::stats::reset();
+    EXPECT_NE(value_of_limbs<UInt1024>(16) / value_of_limbs<UInt1024>(15), 0);
+    c = gint::stats::snapshot();
+    EXPECT_EQ(c.knuth, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+
+    using UInt2048 = gint::integer<2048, unsigned>;
+    gint::stats::reset();
+    EXPECT_NE(value_of_limbs<UInt2048>(32) / value_of_limbs<UInt2048>(5), 0);
+    c = gint::stats::snapshot();
+    EXPECT_EQ(c.reciprocal, 1u);
+    EXPECT_EQ(division_entries(c), 1u);
+}
+
+TEST(PathStats, CountsSignedPromotion)
+{
+    using Int64 = gint::integer<64, signed>;
+    const uint64_t divisor = (uint64_t(1) << 63) + 5;
+    gint::stats::reset();
+    EXPECT_EQ(Int64(-10) / divisor, 0);
+    EXPECT_EQ(Int64(-10) % divisor, -10);
+    const gint::stats::counters c = gint::stats::snapshot();
+    EXPECT_EQ(c.promoted, 2u);
+    EXPECT_EQ(division_entries(c), 2u);
+}
+
+TEST(PathStats, CountsParseAndToStringBuckets)
+{
+    gint::stats::reset();
+    EXPECT_EQ(gint::from_string<gint::UInt256>("0x1f"), 31);
+    EXPECT_EQ(gint::from_string<gint::Int256>("-12345"), -12345);
+    EXPECT_EQ(gint::from_string<gint::UInt256>("zz", 36), 1295);
+    EXPECT_EQ(gint::to_string(gint::Int256(-12345)), "-12345");
+    EXPECT_EQ(gint::to_string(~gint::UInt256(0)).size(), 78u);
+    const gint::stats::counters c = gint::stats::snapshot();
+    EXPECT_EQ(c.parse_base[16], 1u);
+    EXPECT_EQ(c.parse_base[10], 1u);
+    EXPECT_EQ(c.parse_base[36], 1u);
+    // Digit counts 2, 5 and 2 land in buckets 2, 3 and 2.
+    EXPECT_EQ(c.parse_length[2], 2u);
+    EXPECT_EQ(c.parse_length[3], 1u);
+    // Output lengths 6 and 78 land in buckets 3 and 7.
+    EXPECT_EQ(c.to_string_length[3], 1u);
+    EXPECT_EQ(c.to_string_length[7], 1u);
+
+    // Lengths past the last bucket share it.
+    gint::stats::reset();
+    const std::string long_input(5000, '1');
+    gint::from_string<gint::UInt256>(long_input);
+    EXPECT_EQ(gint::stats::snapshot().parse_length[gint::stats::length_buckets - 1], 1u);
+}
+
+TEST(PathStats, CountersArePerThread)
+{
+    const gint::UInt256 dividend = value_of_limbs<gint::UInt256>(4);
+    gint::stats::reset();
+    gint::UInt256 sum = 0;
+    gint::stats::counters other = {};
+    std::thread worker(
+        [&]
+        {
+            for (int i = 3; i < 13; ++i)
+                sum += dividend / gint::UInt256(2 * i + 1);
+            other = gint::stats::snapshot();
+        });
+    worker.join();
+    EXPECT_NE(sum, 0);
+    EXPECT_EQ(other.single_limb, 10u);
+    EXPECT_EQ(division_entries(gint::stats::snapshot()), 0u);
+}
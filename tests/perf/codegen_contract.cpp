@@ -1,6 +1,7 @@
 #include <gint/gint.h>
 
 #include <cstdint>
+#include <string>
 
 #if defined(__GNUC__) || defined(__clang__)
 #    define GINT_PERF_NOINLINE __attribute__((noinline))
@@ -8,6 +9,10 @@
 #    error "The code-generation contract supports GCC and Clang only"
 #endif
 
+using UInt192 = gint::integer<192, unsigned>;
+using UInt1024 = gint::integer<1024, unsigned>;
+using Int64 = gint::integer<64, signed>;
+
 extern "C" {
 
 GINT_PERF_NOINLINE void gint_perf_add256(gint::UInt256 * out, const gint::UInt256 * lhs, const gint::UInt256 * rhs)
@@ -25,6 +30,16 @@ GINT_PERF_NOINLINE void gint_perf_mul256(gint::UInt256 * out, const gint::UInt25
     *out = *lhs * *rhs;
 }
 
+GINT_PERF_NOINLINE void gint_perf_add192(UInt192 * out, const UInt192 * lhs, const UInt192 * rhs)
+{
+    *out = *lhs + *rhs;
+}
+
+GINT_PERF_NOINLINE void gint_perf_mul192(UInt192 * out, const UInt192 * lhs, const UInt192 * rhs)
+{
+    *out = *lhs * *rhs;
+}
+
 GINT_PERF_NOINLINE void gint_perf_xor256(gint::UInt256 * out, const gint::UInt256 * lhs, const gint::UInt256 * rhs)
 {
     *out = *lhs ^ *rhs;
@@ -55,9 +70,97 @@ GINT_PERF_NOINLINE std::uint32_t gint_perf_mod_u32(const gint::UInt256 * dividen
     return static_cast<std::uint32_t>(*dividend % divisor);
 }
 
+GINT_PERF_NOINLINE void gint_perf_div_by_1e19(gint::UInt256 * quotient, const gint::UInt256 * dividend)
+{
+    *quotient = gint::div_by<10000000000000000000ULL>(*dividend);
+}
+
+GINT_PERF_NOINLINE void gint_perf_mod_by_prime(gint::UInt256 * remainder, const gint::UInt256 * dividend)
+{
+    *remainder = gint::mod_by<1000000007ULL>(*dividend);
+}
+
+GINT_PERF_NOINLINE void gint_perf_div_by_1e38(gint::UInt256 * quotient, const gint::UInt256 * dividend)
+{
+    *quotient = gint::div_by<0x4b3b4ca85a86c47aULL, 0x098a224000000000ULL>(*dividend);
+}
+
+GINT_PERF_NOINLINE int gint_perf_countl_zero256(const gint::UInt256 * value)
+{
+    return gint::countl_zero(*value);
+}
+
+GINT_PERF_NOINLINE int gint_perf_countr_zero256(const gint::UInt256 * value)
+{
+    return gint::countr_zero(*value);
+}
+
+GINT_PERF_NOINLINE int gint_perf_popcount256(const gint::UInt256 * value)
+{
+    return gint::popcount(*value);
+}
+
+GINT_PERF_NOINLINE void gint_perf_rotl256(gint::UInt256 * out, const gint::UInt256 * value, int count)
+{
+    *out = gint::rotl(*value, count);
+}
+
+GINT_PERF_NOINLINE void gint_perf_byteswap256(gint::UInt256 * out, const gint::UInt256 * value)
+{
+    *out = gint::byteswap(*value);
+}
+
+GINT_PERF_NOINLINE int gint_perf_decimal_digits256(const gint::UInt256 * value)
+{
+    return gint::decimal_digits(*value);
+}
+
+GINT_PERF_NOINLINE void
+gint_perf_fixed_mul_q128(gint::fixed<256, 128> * out, const gint::fixed<256, 128> * lhs, const gint::fixed<256, 128> * rhs)
+{
+    *out = *lhs * *rhs;
+}
+
 GINT_PERF_NOINLINE unsigned gint_perf_hex_digit(unsigned char value)
 {
     return gint::detail::hexadecimal_digit_value(value);
 }
 
+// Not budgeted: these reach every site GINT_ENABLE_PATH_STATS counts, so the
+// contract's forbidden_symbols check covers them in the default build.
+GINT_PERF_NOINLINE void gint_perf_div256(gint::UInt256 * quotient, const gint::UInt256 * dividend, const gint::UInt256 * divisor)
+{
+    *quotient = *dividend / *divisor;
+}
+
+GINT_PERF_NOINLINE void gint_perf_mod_i256(gint::Int256 * remainder, const gint::Int256 * dividend, const gint::Int256 * divisor)
+{
+    *remainder = *dividend % *divisor;
+}
+
+GINT_PERF_NOINLINE void gint_perf_div1024(UInt1024 * quotient, const UInt1024 * dividend, const UInt1024 * divisor)
+{
+    *quotient = *dividend / *divisor;
+}
+
+GINT_PERF_NOINLINE void gint_perf_div_i128(gint::Int128 * quotient, const gint::Int128 * dividend, const gint::Int128 * divisor)
+{
+    *quotient = *dividend / *divisor;
+}
+
+GINT_PERF_NOINLINE void gint_perf_div_i64_by_u64(Int64 * quotient, const Int64 * dividend, std::uint64_t divisor)
+{
+    *quotient = *dividend / divisor;
+}
+
+GINT_PERF_NOINLINE void gint_perf_parse256(gint::UInt256 * out, const std::string * text)
+{
+    *out = gint::from_string<gint::UInt256>(*text);
+}
+
+GINT_PERF_NOINLINE void gint_perf_to_string256(std::string * out, const gint::UInt256 * value)
+{
+    *out = gint::to_string(*value);
+}
+
 } // extern "C"
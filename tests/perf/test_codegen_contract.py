@@ -234,5 +234,32 @@ class EvaluateContractTest(unittest.TestCase):
         self.assertEqual(len(violations), 1)
 
 
+class SymbolReferencesTest(unittest.TestCase):
+    DISABLED = """
+gint_perf_div256:
+    callq _ZN4gint27config_d0_r0_s0_g1_c0_a0_e17integerILm256EjE10div_large_2
+    ret
+"""
+    ENABLED = """
+gint_perf_div256:
+    addq $1, %fs:_ZZN4gint27config_d0_r0_s1_g1_c0_a0_e16detail19path_stats_countersEvE8counters@tpoff+24
+    ret
+"""
+
+    def test_rejects_forbidden_symbols_in_default_build(self):
+        _, violations = CODEGEN.check_symbol_references(self.DISABLED, ["path_stats"])
+        self.assertEqual(violations, [])
+        references, violations = CODEGEN.check_symbol_references(self.ENABLED, ["path_stats"])
+        self.assertEqual(len(references), 1)
+        self.assertEqual(references[0]["line"], 3)
+        self.assertEqual(len(violations), 1)
+
+    def test_expected_symbols_must_appear_in_enabled_build(self):
+        _, violations = CODEGEN.check_symbol_references(self.ENABLED, ["path_stats"], True)
+        self.assertEqual(violations, [])
+        _, violations = CODEGEN.check_symbol_references(self.DISABLED, ["path_stats"], True)
+        self.assertEqual(violations, ["no reference to path_stats"])
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -92,6 +92,131 @@ class SummarizeDocumentTest(unittest.TestCase):
         markdown = SUMMARY.render_markdown({"gint": suite}, {})
         self.assertIn("`Div/gint`: 8.00%", markdown)
 
+    def test_pairs_latency_rows_with_throughput_rows(self):
+        latency = aggregate("Latency/Div/SmallDivisor64/gint", "median", 0.042)
+        latency["time_unit"] = "us"
+        suite = SUMMARY.summarize_document(
+            {
+                "benchmarks": [
+                    aggregate("Div/SmallDivisor64/gint", "median", 21.0),
+                    latency,
+                    aggregate("Latency/Mul/U64xU64/gint", "median", 16.0),
+                ]
+            }
+        )
+        self.assertEqual(len(suite["latency_pairs"]), 1)
+        pair = suite["latency_pairs"][0]
+        self.assertEqual(pair["name"], "Div/SmallDivisor64/gint")
+        self.assertAlmostEqual(pair["latency_ns"], 42.0)
+        self.assertAlmostEqual(pair["latency_ratio"], 2.0)
+        markdown = SUMMARY.render_markdown({"gint": suite}, {})
+        self.assertIn("| `Div/SmallDivisor64/gint` | 21.00 | 42.00 | 2.00x |", markdown)
+
+    def test_tabulates_and_diffs_hardware_counters(self):
+        def with_counters(name, cycles, instructions):
+            row = aggregate(name, "median", 10.0)
+            row.update(
+                {
+                    "cycles": cycles,
+                    "instructions": instructions,
+                    "IPC": instructions / cycles,
+                    "branch_misses": 0.5,
+                }
+            )
+            return row
+
+        baseline = SUMMARY.summarize_document(
+            {"benchmarks": [with_counters("Div/gint", 40.0, 80.0)]}
+        )
+        suite = SUMMARY.summarize_document(
+            {
+                "benchmarks": [
+                    with_counters("Div/gint", 50.0, 80.0),
+                    aggregate("Add/gint", "median", 1.0),
+                ]
+            }
+        )
+        self.assertEqual(suite["benchmarks"][0]["perf_counters"]["cycles"], 50.0)
+        self.assertNotIn("perf_counters", suite["benchmarks"][1])
+        diff = SUMMARY.perf_counter_diff(baseline, suite)
+        self.assertEqual(len(diff), 1)
+        self.assertAlmostEqual(diff[0]["changes"]["cycles"], 0.25)
+        self.assertAlmostEqual(diff[0]["changes"]["instructions"], 0.0)
+        self.assertNotIn("l1d_misses", diff[0]["changes"])
+        suite["perf_counter_diff"] = diff
+        markdown = SUMMARY.render_markdown({"gint": suite}, {})
+        self.assertIn("| `Div/gint` | 50.00 | 80.00 | 1.60 | 0.50 | n/a |", markdown)
+        self.assertIn("| `Div/gint` | +25.00% | +0.00% | -20.00% | +0.00% | n/a |", markdown)
+
+    def test_builds_width_scaling_table_and_flags_growth_over_expected(self):
+        suite = SUMMARY.summarize_document(
+            {
+                "benchmarks": [
+                    aggregate("Add/gint/bits:128", "median", 2.0),
+                    aggregate("Add/gint/bits:256", "median", 3.0),
+                    aggregate("Add/gint/bits:1024", "median", 30.0),
+                    aggregate("Mul/HighxHigh/gint/bits:128", "median", 1.0),
+                    aggregate("Mul/HighxHigh/gint/bits:1024", "median", 42.0),
+                    aggregate("Latency/Mul/U64xU64/gint/bits:128", "median", 1.0),
+                    aggregate("Latency/Mul/U64xU64/gint/bits:1024", "median", 42.0),
+                    aggregate("Mod/SimilarMagnitude/gint/bits:128", "median", 1.0),
+                    aggregate("Mod/SimilarMagnitude/gint/bits:1024", "median", 90.0),
+                    aggregate("Bucketize/Lookup/gint/bits:128/16", "median", 4.0),
+                    aggregate("Bucketize/Lookup/gint/bits:256/16", "median", 6.0),
+                    aggregate("Column/Add256/gint", "median", 1.0),
+                ]
+            }
+        )
+        scaling = dict((row["name"], row) for row in suite["width_scaling"])
+        self.assertEqual(
+            sorted(scaling),
+            [
+                "Add/gint",
+                "Bucketize/Lookup/gint/16",
+                "Latency/Mul/U64xU64/gint",
+                "Mod/SimilarMagnitude/gint",
+                "Mul/HighxHigh/gint",
+            ],
+        )
+        self.assertAlmostEqual(scaling["Add/gint"]["ratio_to_128"]["1024"], 15.0)
+        self.assertEqual(scaling["Add/gint"]["over_expected_bits"], [1024])
+        self.assertEqual(scaling["Bucketize/Lookup/gint/16"]["over_expected_bits"], [])
+        # A quadratic product is not flagged for growing quadratically.
+        self.assertEqual(scaling["Mul/HighxHigh/gint"]["expected_exponent"], 2.0)
+        self.assertEqual(scaling["Mul/HighxHigh/gint"]["over_expected_bits"], [])
+        # A single-limb operand keeps the product linear, latency rows included.
+        self.assertEqual(scaling["Latency/Mul/U64xU64/gint"]["expected_exponent"], 1.0)
+        self.assertEqual(scaling["Latency/Mul/U64xU64/gint"]["over_expected_bits"], [1024])
+        self.assertEqual(scaling["Mod/SimilarMagnitude/gint"]["expected_exponent"], 1.0)
+        self.assertEqual(scaling["Mod/SimilarMagnitude/gint"]["over_expected_bits"], [1024])
+        markdown = SUMMARY.render_markdown({"all_widths": suite}, {})
+        self.assertIn("| 用例 | 128 | 256 | 1024 | 256/128 | 1024/128 | 预期 | 超预期 |", markdown)
+        self.assertIn("| `Add/gint` | 2.00 | 3.00 | 30.00 | 1.50x | 15.00x | n^1 | 1024 |", markdown)
+        self.assertIn("| `Mul/HighxHigh/gint` | 1.00 | n/a | 42.00 | n/a | 42.00x | n^2 |  |", markdown)
+        self.assertIn("| `Bucketize/Lookup/gint/16` | 4.00 | 6.00 | n/a | 1.50x | n/a | n^1 |  |", markdown)
+
+    def test_flags_quadratic_division_with_a_single_quotient_limb(self):
+        suite = SUMMARY.summarize_document(
+            {
+                "benchmarks": [
+                    aggregate("Div/SimilarMagnitude/gint/bits:128", "median", 1.0),
+                    aggregate("Div/SimilarMagnitude/gint/bits:1024", "median", 64.0),
+                    aggregate("DivMod/SimilarMagnitudeSeparate/gint/bits:128", "median", 1.0),
+                    aggregate("DivMod/SimilarMagnitudeSeparate/gint/bits:1024", "median", 8.0),
+                    aggregate("Div/LargeDivisor128/gint/bits:128", "median", 1.0),
+                    aggregate("Div/LargeDivisor128/gint/bits:1024", "median", 64.0),
+                ]
+            }
+        )
+        scaling = dict((row["name"], row) for row in suite["width_scaling"])
+        # One quotient limb, or a fixed two-limb divisor, keeps division linear:
+        # growing with the square of the width is flagged.
+        self.assertEqual(scaling["Div/SimilarMagnitude/gint"]["expected_exponent"], 1.0)
+        self.assertEqual(scaling["Div/SimilarMagnitude/gint"]["over_expected_bits"], [1024])
+        self.assertEqual(scaling["DivMod/SimilarMagnitudeSeparate/gint"]["over_expected_bits"], [])
+        self.assertEqual(scaling["Div/LargeDivisor128/gint"]["expected_exponent"], 1.0)
+        self.assertEqual(scaling["Div/LargeDivisor128/gint"]["over_expected_bits"], [1024])
+
 
 if __name__ == "__main__":
     unittest.main()
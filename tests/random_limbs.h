@@ -0,0 +1,40 @@
+#ifndef GINT_TESTS_RANDOM_LIMBS_H
+#define GINT_TESTS_RANDOM_LIMBS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <gint/gint.h>
+
+// Operand generators for the suites that check a kernel or container against
+// a plain per-value loop.
+namespace gint_test
+{
+// The low `limbs` limbs drawn at random, the rest zero.
+template <typename Int>
+Int random_limbs(std::mt19937_64 & rng, size_t limbs = Int::limbs)
+{
+    Int value = 0;
+    for (size_t i = 0; i < limbs; ++i)
+        value = (value << 64) | Int(rng());
+    return value;
+}
+
+// Each limb zero, all ones or random: runs of saturated limbs drive carry and
+// borrow chains and per-limb sums that wrap early.
+template <typename Int>
+Int random_limb_pattern(std::mt19937_64 & rng)
+{
+    Int value = 0;
+    for (size_t i = 0; i < Int::limbs; ++i)
+    {
+        const uint64_t kind = rng() % 4;
+        const uint64_t limb = kind == 0 ? 0 : kind == 1 ? ~uint64_t(0) : rng();
+        value = (value << 64) | Int(limb);
+    }
+    return value;
+}
+} // namespace gint_test
+
+#endif
@@ -0,0 +1,121 @@
+#include <limits>
+#include <random>
+#include <vector>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+template <typename Int>
+void expect_below(uint64_t seed, const Int & bound)
+{
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < 200; ++i)
+    {
+        const Int value = gint::uniform_below(rng, bound);
+        EXPECT_GE(value, Int(0));
+        EXPECT_LT(value, bound);
+    }
+}
+// Replays fixed 64-bit outputs.
+struct replay_generator
+{
+    using result_type = uint64_t;
+    std::vector<uint64_t> outputs;
+    size_t next;
+
+    explicit replay_generator(std::vector<uint64_t> values) : outputs(values), next(0) { }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~uint64_t(0); }
+    result_type operator()() { return outputs[next++ % outputs.size()]; }
+};
+} // namespace
+
+TEST(Random, RandomBitsFillsLowLimbFirst)
+{
+    std::mt19937_64 rng64(1);
+    std::mt19937_64 expected64(1);
+    const gint::UInt256 wide = gint::random_bits<256>(rng64);
+    gint::UInt256 limbs = 0;
+    for (int i = 0; i < 4; ++i)
+        limbs |= gint::UInt256(expected64()) << (64 * i);
+    EXPECT_EQ(wide, limbs);
+
+    // A 32-bit generator supplies each limb from two calls, low half first.
+    std::mt19937 rng32(2);
+    std::mt19937 expected32(2);
+    const gint::UInt128 narrow = gint::random_bits<128>(rng32);
+    gint::UInt128 halves = 0;
+    for (int i = 0; i < 4; ++i)
+        halves |= gint::UInt128(static_cast<uint64_t>(expected32())) << (32 * i);
+    EXPECT_EQ(narrow, halves);
+}
+
+TEST(Random, UniformBelowStaysInRange)
+{
+    using gint::UInt256;
+    const UInt256 one = 1;
+    const UInt256 bounds[] = {
+        one,
+        UInt256(2),
+        UInt256(6),
+        UInt256(~uint64_t(0)),
+        one << 64,
+        (one << 64) + one,
+        (one << 200) + UInt256(12345),
+        (one << 255) + one,
+        ~UInt256(0),
+    };
+    uint64_t seed = 3;
+    for (const UInt256 & bound : bounds)
+        expect_below(seed++, bound);
+    expect_below(seed++, gint::Int128(1000));
+    using Int512 = gint::integer<512, signed>;
+    using UInt512 = gint::integer<512, unsigned>;
+    expect_below(seed++, std::numeric_limits<Int512>::max());
+    expect_below(seed++, (UInt512(1) << 320) + UInt512(7));
+
+    std::mt19937_64 rng(seed);
+    EXPECT_EQ(gint::uniform_below(rng, one), UInt256(0));
+}
+
+TEST(Random, UniformBelowIsUnbiased)
+{
+    // Each of 6 values should come up about 10000 times in 60000 draws.
+    std::mt19937_64 rng(20);
+    std::vector<int> counts(6);
+    for (int i = 0; i < 60000; ++i)
+        ++counts[static_cast<size_t>(gint::uniform_below(rng, gint::UInt256(6)))];
+    for (int count : counts)
+    {
+        EXPECT_GT(count, 9400);
+        EXPECT_LT(count, 10600);
+    }
+
+    // Modulo would put half of the draws below 2^254 for this bound instead
+    // of a third.
+    const gint::UInt256 quarter = gint::UInt256(1) << 254;
+    const gint::UInt256 bound = quarter * gint::UInt256(3);
+    int low = 0;
+    for (int i = 0; i < 30000; ++i)
+        low += gint::uniform_below(rng, bound) < quarter;
+    EXPECT_GT(low, 9400);
+    EXPECT_LT(low, 10600);
+}
+
+TEST(Random, UniformBelowRetriesOnlyBelowThreshold)
+{
+    // For 6, 2^64 mod 6 = 4: a zero draw leaves a low half of 0 and is
+    // retried, while 2 * 2^64 + 4 leaves exactly 4 and is kept as 2.
+    replay_generator small({0, 6148914691236517206ull});
+    EXPECT_EQ(gint::uniform_below(small, gint::UInt256(6)), gint::UInt256(2));
+    EXPECT_EQ(small.next, 2u);
+
+    // The all-ones bound draws five limbs; 2^320 mod (2^256 - 1) = 2^64, so
+    // zero is retried and all-ones gives floor((2^320 - 1)(2^256 - 1) / 2^320).
+    replay_generator wide({0, 0, 0, 0, 0, ~uint64_t(0), ~uint64_t(0), ~uint64_t(0), ~uint64_t(0), ~uint64_t(0)});
+    const gint::UInt256 all_ones = ~gint::UInt256(0);
+    EXPECT_EQ(gint::uniform_below(wide, all_ones), all_ones - gint::UInt256(1));
+    EXPECT_EQ(wide.next, 10u);
+}
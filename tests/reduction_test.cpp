@@ -0,0 +1,181 @@
+#include <limits>
+#include <random>
+#include <vector>
+#include <gint/gint.h>
+#include <gtest/gtest.h>
+
+#include "random_limbs.h"
+
+namespace
+{
+template <size_t Bits, typename Signed>
+void expect_reductions_match_loop(uint64_t seed, size_t count)
+{
+    using Int = gint::integer<Bits, Signed>;
+    using Wide = gint::integer<Bits + 64, Signed>;
+    std::mt19937_64 rng(seed);
+    std::vector<Int> values;
+    for (size_t i = 0; i < count; ++i)
+        values.push_back(gint_test::random_limb_pattern<Int>(rng));
+    const gint::column<Bits, Signed> rows(values.data(), values.size());
+
+    Wide expected_sum = 0;
+    Int expected_min = std::numeric_limits<Int>::max();
+    Int expected_max = std::numeric_limits<Int>::min();
+    for (const Int & value : values)
+    {
+        expected_sum += Wide(value);
+        expected_min = value < expected_min ? value : expected_min;
+        expected_max = expected_max < value ? value : expected_max;
+    }
+
+    Wide sum = 7;
+    gint::reduce_sum(values.data(), values.size(), sum);
+    EXPECT_EQ(sum, expected_sum + Wide(7));
+    Wide column_sum = 0;
+    gint::reduce_sum(rows, column_sum);
+    EXPECT_EQ(column_sum, expected_sum);
+
+    Int low = std::numeric_limits<Int>::max();
+    Int high = std::numeric_limits<Int>::min();
+    gint::reduce_min(values.data(), values.size(), low);
+    gint::reduce_max(values.data(), values.size(), high);
+    EXPECT_EQ(low, expected_min);
+    EXPECT_EQ(high, expected_max);
+    low = std::numeric_limits<Int>::max();
+    high = std::numeric_limits<Int>::min();
+    gint::reduce_min(rows, low);
+    gint::reduce_max(rows, high);
+    EXPECT_EQ(low, expected_min);
+    EXPECT_EQ(high, expected_max);
+
+    const gint::divmod_result<Wide> mean = gint::divmod(expected_sum, Wide(count));
+    const gint::divmod_result<Int> average = gint::reduce_avg(values.data(), values.size());
+    EXPECT_EQ(Wide(average.quotient), mean.quotient);
+    EXPECT_EQ(Wide(average.remainder), mean.remainder);
+    const gint::divmod_result<Int> column_average = gint::reduce_avg(rows);
+    EXPECT_EQ(column_average.quotient, average.quotient);
+    EXPECT_EQ(column_average.remainder, average.remainder);
+}
+} // namespace
+
+TEST(Reduction, MatchesRowLoop)
+{
+    expect_reductions_match_loop<256, unsigned>(1, 1000);
+    expect_reductions_match_loop<256, signed>(2, 1003);
+    expect_reductions_match_loop<128, signed>(3, 17);
+    expect_reductions_match_loop<512, unsigned>(4, 301);
+    expect_reductions_match_loop<64, signed>(5, 9);
+}
+
+TEST(Reduction, SumKeepsOverflowInExtraLimb)
+{
+    const gint::UInt256 top = std::numeric_limits<gint::UInt256>::max();
+    const std::vector<gint::UInt256> values(5, top);
+    using Wide = gint::integer<320, unsigned>;
+    Wide sum = 0;
+    gint::reduce_sum(values.data(), values.size(), sum);
+    EXPECT_EQ(sum, Wide(top) * 5u);
+    EXPECT_GT(sum, Wide(top));
+
+    const gint::Int256 lowest = std::numeric_limits<gint::Int256>::min();
+    const std::vector<gint::Int256> negative(3, lowest);
+    using SignedWide = gint::integer<320, signed>;
+    SignedWide signed_sum = 0;
+    gint::reduce_sum(gint::column<256, signed>(negative.data(), negative.size()), signed_sum);
+    EXPECT_EQ(signed_sum, SignedWide(lowest) * 3);
+}
+
+TEST(Reduction, AverageTruncatesTowardZero)
+{
+    const std::vector<gint::Int128> values = {gint::Int128(-5), gint::Int128(-6)};
+    const gint::divmod_result<gint::Int128> average = gint::reduce_avg(values.data(), values.size());
+    EXPECT_EQ(average.quotient, gint::Int128(-5));
+    EXPECT_EQ(average.remainder, gint::Int128(-1));
+}
+
+TEST(Reduction, EmptyRangeLeavesAccumulators)
+{
+    using Wide = gint::integer<192, unsigned>;
+    Wide sum = 3;
+    gint::UInt128 low = 9;
+    gint::reduce_sum(static_cast<const gint::UInt128 *>(nullptr), 0, sum);
+    gint::reduce_min(static_cast<const gint::UInt128 *>(nullptr), 0, low);
+    gint::reduce_sum(gint::column<128, unsigned>(), sum);
+    EXPECT_EQ(sum, Wide(3));
+    EXPECT_EQ(low, gint::UInt128(9));
+}
+
+TEST(Reduction, AccumulatorMatchesWideSumAndMerges)
+{
+    using Int = gint::Int256;
+    using Wide = gint::integer<320, signed>;
+    std::mt19937_64 rng(6);
+    gint::accumulator<256, signed> whole;
+    gint::accumulator<256, signed> first;
+    gint::accumulator<256, signed> second;
+    Wide expected = 0;
+    for (int i = 0; i < 500; ++i)
+    {
+        const Int value = gint_test::random_limb_pattern<Int>(rng);
+        expected += Wide(value);
+        whole += value;
+        (i % 3 == 0 ? first : second) += value;
+    }
+    EXPECT_EQ(whole.value(), expected);
+    first += second;
+    EXPECT_EQ(first.value(), expected);
+
+    // Unsigned wraps in every limb at once must all reach the extra limb.
+    using Wide192 = gint::integer<192, unsigned>;
+    gint::accumulator<128, unsigned> saturated;
+    for (int i = 0; i < 4; ++i)
+        saturated += std::numeric_limits<gint::UInt128>::max();
+    EXPECT_EQ(saturated.value(), Wide192(std::numeric_limits<gint::UInt128>::max()) * 4u);
+    saturated.clear();
+    EXPECT_EQ(saturated.value(), Wide192(0));
+}
+
+TEST(Reduction, ScansMatchPartialSums)
+{
+    using Int = gint::Int256;
+    std::mt19937_64 rng(7);
+    std::vector<Int> values;
+    for (int i = 0; i < 300; ++i)
+        values.push_back(gint_test::random_limb_pattern<Int>(rng));
+    const Int init = -gint_test::random_limb_pattern<Int>(rng);
+    std::vector<Int> inclusive(values.size());
+    std::vector<Int> exclusive(values.size());
+    Int sum = init;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        exclusive[i] = sum;
+        sum += values[i];
+        inclusive[i] = sum;
+    }
+
+    std::vector<Int> out(values.size());
+    gint::inclusive_scan(values.data(), values.size(), out.data(), init);
+    EXPECT_EQ(out, inclusive);
+    gint::exclusive_scan(values.data(), values.size(), out.data(), init);
+    EXPECT_EQ(out, exclusive);
+    out = values;
+    gint::exclusive_scan(out.data(), out.size(), out.data(), init);
+    EXPECT_EQ(out, exclusive);
+
+    gint::column<256, signed> rows(values.data(), values.size());
+    gint::column<256, signed> scanned;
+    gint::inclusive_scan(rows, scanned, init);
+    ASSERT_EQ(scanned.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(scanned[i], inclusive[i]);
+    gint::exclusive_scan(rows, rows, init);
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(rows[i], exclusive[i]);
+
+    // Widths that scan through operator+ rather than the 256-bit adc chain.
+    const std::vector<gint::UInt128> small = {gint::UInt128(5), ~gint::UInt128(0), gint::UInt128(3)};
+    std::vector<gint::UInt128> small_out(small.size());
+    gint::inclusive_scan(small.data(), small.size(), small_out.data());
+    EXPECT_EQ(small_out, (std::vector<gint::UInt128>{gint::UInt128(5), gint::UInt128(4), gint::UInt128(7)}));
+}
@@ -123,3 +123,37 @@ TEST(WideIntegerStream, ToStringSignedMinValues)
     S256 s256_min = std::numeric_limits<S256>::min();
     EXPECT_EQ(gint::to_string(s256_min), std::string("-57896044618658097711785492504343953926634992332820282019728792003956564819968"));
 }
+
+TEST(WideIntegerStream, ToCharsMatchesToString)
+{
+    using S256 = gint::integer<256, signed>;
+    using U512 = gint::integer<512, unsigned>;
+    const S256 signed_values[] = {S256(0), S256(-1), S256(10), S256(-9999999999999999999ULL), std::numeric_limits<S256>::min(),
+                                  std::numeric_limits<S256>::max(), S256(123456789) << 150};
+    for (const S256 & value : signed_values)
+    {
+        const std::string expected = gint::to_string(value);
+        char buffer[96];
+        const gint::to_chars_result result = gint::to_chars(buffer, buffer + sizeof(buffer), value);
+        EXPECT_EQ(result.ec, std::errc());
+        EXPECT_EQ(std::string(buffer, result.ptr), expected);
+
+        const gint::to_chars_result exact = gint::to_chars(buffer, buffer + expected.size(), value);
+        EXPECT_EQ(exact.ec, std::errc());
+        EXPECT_EQ(exact.ptr, buffer + expected.size());
+
+        const gint::to_chars_result short_result = gint::to_chars(buffer, buffer + expected.size() - 1, value);
+        EXPECT_EQ(short_result.ec, std::errc::value_too_large);
+        EXPECT_EQ(short_result.ptr, buffer + expected.size() - 1);
+    }
+
+    // Exercise 10^19 chunk boundaries and interior zero chunks at a wider width.
+    U512 power = 1;
+    for (int exponent = 0; exponent < 150; ++exponent)
+    {
+        const std::string digits = std::string("1") + std::string(static_cast<size_t>(exponent), '0');
+        EXPECT_EQ(gint::to_string(power), digits);
+        EXPECT_EQ(gint::to_string(power + U512(7)), exponent == 0 ? std::string("8") : digits.substr(0, digits.size() - 1) + "7");
+        power *= U512(10);
+    }
+}